@@ -43,13 +43,23 @@ public class AssetTracker : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
-                "EditorScriptingUtilities",
-				"AssetRegistry",
-				"UnrealEd",
-                "MaterialEditor"
+				"AssetRegistry"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
+
+		// 에디터 전용 의존성 - 패키지(런타임) 빌드에서는 쿠킹된 UUID 테이블만 사용
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.AddRange(
+				new string[]
+				{
+					"EditorScriptingUtilities",
+					"UnrealEd",
+					"MaterialEditor"
+				}
+				);
+		}
 		
 		
 		DynamicallyLoadedModuleNames.AddRange(
@@ -1,24 +1,40 @@
 ﻿// Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AssetTracker.h"
+#include "AssetTrackerUuidTable.h"
+#include "AssetTrackerHistory.h"
+#include "AssetTrackerEventPipeline.h"
+#include "AssetTrackerHttpSink.h"
+#include "AssetTrackerSharedMemorySink.h"
+#include "AssetTrackerWorldIndex.h"
+#include "AssetTrackerMetaStore.h"
 #include "Modules/ModuleManager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "EditorAssetLibrary.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
 #include "Json.h"
+#if WITH_EDITOR
+#include "EditorAssetLibrary.h"
 #include "Editor.h"
 #include "LevelEditor.h"
 #include "Editor/UnrealEd/Public/Editor.h"
+#include "GameDelegates.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+#endif
 #include "Materials/MaterialInstance.h"
 #include "Materials/MaterialInterface.h"
 #include "Materials/MaterialParameterCollection.h"
 #include "Engine/StaticMeshActor.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Materials/Material.h"
 #include "EngineUtils.h"  // TActorIterator를 위해 필요
 #include "Engine/World.h"
+#include "Engine/Level.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialExpression.h"
 #include "Materials/MaterialExpressionTextureSample.h"
@@ -26,15 +42,80 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Misc/Base64.h"                 // FBase64::Decode
+#include "Algo/StableSort.h"
 
 
 #define LOCTEXT_NAMESPACE "FAssetTrackerModule"
 
+namespace AssetTracker
+{
+    const double TransformTolerance = 0.01;
+
+    static bool bEnableReconciliation = false;
+    static FAutoConsoleVariableRef CVarEnableReconciliation(
+        TEXT("AssetTracker.Reconcile.Enable"),
+        bEnableReconciliation,
+        TEXT("Periodically compare tracked actor transforms against stored snapshots to catch changes missed by editor delegates."));
+
+    static int32 ReconcileActorsPerTick = 256;
+    static FAutoConsoleVariableRef CVarReconcileActorsPerTick(
+        TEXT("AssetTracker.Reconcile.ActorsPerTick"),
+        ReconcileActorsPerTick,
+        TEXT("Number of tracked actors compared per editor tick during a reconciliation sweep."));
+
+    static float ReconcileInterval = 2.0f;
+    static FAutoConsoleVariableRef CVarReconcileInterval(
+        TEXT("AssetTracker.Reconcile.Interval"),
+        ReconcileInterval,
+        TEXT("Seconds to wait between full reconciliation sweeps."));
+
+    FAssetTrackerEvent MakeHierarchyEvent(AActor* Root, const FGuid& Uuid, int32 ChatId, int32 UserId, uint8 ChangeMask, const FTransform& CurrentTransform, const FTransform& LastTransform)
+    {
+        FAssetTrackerEvent Event;
+        Event.TimestampTicks = FDateTime::UtcNow().GetTicks();
+        Event.ActorName = Root->GetFName();
+        Event.WorldPackage = Root->GetOutermost()->GetFName();
+        Event.ChatId = ChatId;
+        Event.UserId = UserId;
+        Event.Change = EAssetTrackerChange::Hierarchy;
+        Event.Uuid = Uuid;
+        Event.TransformMask = ChangeMask;
+        Event.LocationDelta = FVector3f(CurrentTransform.GetLocation() - LastTransform.GetLocation());
+        return Event;
+    }
+}
+
+FAssetTrackerModule& FAssetTrackerModule::Get()
+{
+    return FModuleManager::LoadModuleChecked<FAssetTrackerModule>("AssetTracker");
+}
+
 void FAssetTrackerModule::StartupModule()
 {
     LoadMetaJson();
+
+    if (!IsRunningCommandlet())
+    {
+        History.Open(FPaths::ProjectSavedDir() / TEXT("AssetTracker/History"));
+    }
+
+    EventPipeline.AddSink(MakeUnique<FAssetTrackerHistorySink>(History));
+    EventPipeline.AddSink(MakeUnique<FAssetTrackerHttpSink>());
+    EventPipeline.AddSink(MakeUnique<FAssetTrackerSharedMemorySink>());
+    EventPipeline.Start();
+
+#if WITH_EDITOR
     TagExistingAssets();
 
+    // 쿠킹(커맨드릿 포함) 시 UUID 테이블 베이크
+    if (GIsEditor)
+    {
+        // 단일 델리게이트이므로 프로젝트의 기존 바인딩을 보관했다가 이어서 호출
+        FCookModificationDelegate& CookDelegate = FGameDelegates::Get().GetCookModificationDelegate();
+        PreviousCookModificationDelegate = CookDelegate;
+        CookDelegate.BindRaw(this, &FAssetTrackerModule::BakeUuidTable);
+    }
+
     if (GIsEditor && !IsRunningCommandlet())
     {
         if (GEditor)
@@ -42,30 +123,59 @@ void FAssetTrackerModule::StartupModule()
             // 액터 이벤트들
             GEditor->OnActorMoved().AddRaw(this, &FAssetTrackerModule::OnActorMoved);
 
+            // 블루프린트 컴파일 시 클래스 단위 UUID 캐시 무효화
+            GEditor->OnBlueprintCompiled().AddRaw(this, &FAssetTrackerModule::OnBlueprintCompiled);
+
             // 레벨 액터 추가/삭제 델리게이트 추가
             if (GEngine)
             {
                 GEngine->OnLevelActorAdded().AddRaw(this, &FAssetTrackerModule::OnActorAdded);
+                GEngine->OnLevelActorAttached().AddRaw(this, &FAssetTrackerModule::OnActorAttached);
                 GEngine->OnLevelActorDeleted().AddRaw(this, &FAssetTrackerModule::OnActorDeleted);
             }
         }
 
         FEditorDelegates::OnAssetPostImport.AddRaw(this, &FAssetTrackerModule::OnAssetImported);
         FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FAssetTrackerModule::OnObjectPropertyChanged);
+
+        // World Partition 맵 인덱스
+        FEditorDelegates::OnMapOpened.AddRaw(this, &FAssetTrackerModule::OnMapOpened);
+        FWorldDelegates::OnWorldCleanup.AddRaw(this, &FAssetTrackerModule::OnEditorWorldCleanup);
+        RebuildWorldIndex(GetWorld());
+        AnchorLoadedHierarchies(GetWorld());
+
+        ReconcileTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FAssetTrackerModule::TickReconciliation));
+
+        // ISM/HISM/폴리지 인스턴스 편집 (Modify는 트랜잭션 편집마다 호출됨)
+        FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FAssetTrackerModule::OnObjectModified);
+        FCoreUObjectDelegates::OnPreObjectPropertyChanged.AddRaw(this, &FAssetTrackerModule::OnPreObjectPropertyChanged);
+        InstanceTracker.Start();
+        InstanceTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FAssetTrackerModule::TickInstanceTracking));
+
+        // 이동 변경은 다음 틱에 부착 계층 단위로 병합
+        MoveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FAssetTrackerModule::TickMoveCoalescing));
     }
+#endif
 
-    UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Startup complete, %d entries loaded"), MetaMap.Num());
+    // 패키지 빌드: 쿠킹된 테이블로 스폰되는 액터만 추적
+    if (!GIsEditor)
+    {
+        LoadBakedUuidTable();
+        FWorldDelegates::OnPostWorldInitialization.AddRaw(this, &FAssetTrackerModule::OnPostWorldInitialization);
+        FWorldDelegates::OnWorldCleanup.AddRaw(this, &FAssetTrackerModule::OnWorldCleanup);
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Startup complete, %d entries loaded"), MetaStore.Num());
 
     // 디버깅: 로드된 uuid와 chatId 출력
-    for (const auto& Pair : MetaMap)
+    for (const FAssetTrackerMeta& Entry : MetaStore.GetEntries())
     {
-        const FString& Filename = Pair.Key;
-        const FMetaEntry& Entry = Pair.Value;
-
-        UE_LOG(LogTemp, Log,
-            TEXT("AssetTracker: Loaded meta -> %s : uuid=%s, chatId=%d"),
-            *Filename,
-            *Entry.Uuid,
+        UE_LOG(LogTemp, Verbose,
+            TEXT("AssetTracker: Loaded meta -> uuid=%s, chatId=%d"),
+            *AssetTrackerUuidToString(Entry.Uuid),
             Entry.ChatId
         );
     }
@@ -73,8 +183,44 @@ void FAssetTrackerModule::StartupModule()
 
 void FAssetTrackerModule::ShutdownModule()
 {
+    FWorldDelegates::OnPostWorldInitialization.RemoveAll(this);
+    FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+    BakedUuidTable.Reset();
+    EventPipeline.Shutdown();
+    History.Close();
+
+#if WITH_EDITOR
+    FGameDelegates& GameDelegates = FGameDelegates::Get();
+    if (GameDelegates.GetCookModificationDelegate().IsBoundToObject(this))
+    {
+        GameDelegates.GetCookModificationDelegate() = PreviousCookModificationDelegate;
+    }
+    PreviousCookModificationDelegate.Unbind();
+
     FEditorDelegates::OnAssetPostImport.RemoveAll(this);
     FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+    FEditorDelegates::OnMapOpened.RemoveAll(this);
+    if (ReconcileTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ReconcileTickerHandle);
+        ReconcileTickerHandle.Reset();
+    }
+    FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+    FCoreUObjectDelegates::OnPreObjectPropertyChanged.RemoveAll(this);
+    if (InstanceTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(InstanceTickerHandle);
+        InstanceTickerHandle.Reset();
+    }
+    InstanceTracker.Stop();
+    if (MoveTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(MoveTickerHandle);
+        MoveTickerHandle.Reset();
+    }
+    MoveCoalescer.Empty();
+    ClassUuidCache.Invalidate();
+    RebuildWorldIndex(nullptr);
 
 
     if (GIsEditor)
@@ -85,6 +231,7 @@ void FAssetTrackerModule::ShutdownModule()
             {
                 GEditor->OnActorMoved().RemoveAll(this);
             }
+            GEditor->OnBlueprintCompiled().RemoveAll(this);
         }
         if (GEngine)
         {
@@ -92,70 +239,23 @@ void FAssetTrackerModule::ShutdownModule()
             {
                 GEngine->OnLevelActorAdded().RemoveAll(this);
             }
+            GEngine->OnLevelActorAttached().RemoveAll(this);
             if (GEngine->OnLevelActorDeleted().IsBoundToObject(this))
             {
                 GEngine->OnLevelActorDeleted().RemoveAll(this);
             }
         }
     }
+#endif
 }
 
+#if WITH_EDITOR
 void FAssetTrackerModule::OnActorMoved(AActor* Actor)
 {
     if (!Actor) return;
 
-    FString UUID = GetUUIDFromActorMaterials(Actor);
-    if (!UUID.IsEmpty())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s moved — UUID: %s — Location: %s"),
-            *Actor->GetName(), *UUID, *Actor->GetActorLocation().ToCompactString());
-    }
-    //if (!Actor) return;
-
-    //FString UUID = GetUUIDFromActorMaterials(Actor);
-    //if (UUID.IsEmpty()) return;
-
-    //FTransform CurrentTransform = Actor->GetActorTransform();
-    //FTransform* LastTransform = PreviousActorTransforms.Find(Actor);
-
-    //if (!LastTransform)
-    //{
-    //   PreviousActorTransforms.Add(Actor, CurrentTransform);
-    //    return;
-    //}
-
-    // 변경 항목 판별
-    //const double Tolerance = 0.01;
-    //bool bLocationChanged = !CurrentTransform.GetLocation().Equals(LastTransform->GetLocation(), Tolerance);
-    //bool bRotationChanged = !CurrentTransform.GetRotation().Rotator().Equals(LastTransform->GetRotation().Rotator(), Tolerance);
-    //bool bScaleChanged = !CurrentTransform.GetScale3D().Equals(LastTransform->GetScale3D(), Tolerance);
-
-    // 로그 및 전송
-    //FString TimeStr = FDateTime::UtcNow().ToIso8601();
-
-    //if (bLocationChanged)
-    //{
-    //    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s location changed — UUID: %s — Pos: %s — Time: %s"),
-    //        *Actor->GetName(), *UUID, *CurrentTransform.GetLocation().ToCompactString(), *TimeStr);
-    //    SendActorTrackLog(Actor, UUID, TEXT("RelativeLocation"));
-    //}
-
-    //if (bRotationChanged)
-    //{
-    //    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s rotation changed — UUID: %s — Rot: %s — Time: %s"),
-    //        *Actor->GetName(), *UUID, *CurrentTransform.GetRotation().Rotator().ToCompactString(), *TimeStr);
-    //    SendActorTrackLog(Actor, UUID, TEXT("RelativeRotation"));
-    //}
-
-    //if (bScaleChanged)
-    //{
-    //    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s scale changed — UUID: %s — Scale: %s — Time: %s"),
-    //        *Actor->GetName(), *UUID, *CurrentTransform.GetScale3D().ToCompactString(), *TimeStr);
-    //    SendActorTrackLog(Actor, UUID, TEXT("RelativeScale3D"));
-    //}
-
-    // 캐시 업데이트
-    //PreviousActorTransforms[Actor] = CurrentTransform;
+    // 부모를 옮기면 부착된 하위 액터마다 호출되므로 표시만 하고 다음 틱에 계층 단위로 처리
+    MoveCoalescer.MarkDirty(Actor);
 }
 
 void FAssetTrackerModule::OnActorAdded(AActor* Actor)
@@ -168,51 +268,190 @@ void FAssetTrackerModule::OnActorAdded(AActor* Actor)
         {
             if (IsValid(Actor))
             {
-                FString UUID = GetUUIDFromActorMaterials(Actor);
-                if (!UUID.IsEmpty())
+                FGuid UUID = GetUUIDFromActorMaterials(Actor);
+                if (UUID.IsValid())
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s added — UUID: %s — Location: %s"),
-                        *Actor->GetName(), *UUID, *Actor->GetActorLocation().ToCompactString());
+                    UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s added — UUID: %s — Location: %s"),
+                        *Actor->GetName(), *AssetTrackerUuidToString(UUID), *Actor->GetActorLocation().ToCompactString());
+                    WorldIndex.SetActorUuid(*Actor, UUID);
+                    RegisterTrackedActor(Actor, UUID);
+
+                    const FAssetTrackerMeta* Meta = MetaStore.Find(UUID);
+                    RecordHistory(Actor, UUID, Meta ? Meta->ChatId : 0, Meta ? Meta->UserId : 0, EAssetTrackerChange::Added);
                 }
             }
         }, 0.1f, false);
 }
 
+void FAssetTrackerModule::OnActorAttached(AActor* Actor, const AActor* Parent)
+{
+    if (!Actor) return;
+
+    // 새로 붙은 서브트리에 추적 액터가 있으면 새 조상 체인에 기준 스냅샷을 기록
+    TArray<AActor*> Subtree;
+    Actor->GetAttachedActors(Subtree, false, true);
+    Subtree.Add(Actor);
+    for (AActor* Member : Subtree)
+    {
+        const FGuid UUID = GetUUIDFromActorMaterials(Member);
+        if (UUID.IsValid())
+        {
+            RegisterTrackedActor(Member, UUID);
+        }
+    }
+}
+
+void FAssetTrackerModule::RegisterTrackedActor(AActor* Actor, const FGuid& UUID)
+{
+    PreviousActorTransforms.Set(Actor, Actor->GetActorTransform(), UUID);
+
+    // 조상마다 기준 스냅샷을 미리 기록해서 첫 부모 이동도 루트 이벤트 하나로 병합되게 함
+    for (AActor* Parent = Actor->GetAttachParentActor(); Parent; Parent = Parent->GetAttachParentActor())
+    {
+        FTransform Existing;
+        if (PreviousActorTransforms.Get(Parent, Existing)) continue;
+
+        PreviousActorTransforms.Set(Parent, Parent->GetActorTransform(), GetUUIDFromActorMaterials(Parent));
+    }
+}
+
+void FAssetTrackerModule::AnchorLoadedHierarchies(UWorld* World)
+{
+    if (!World) return;
+
+    // 부착된 액터만 확인 (단독 액터는 첫 이동 때 기준값을 잡아도 병합과 무관)
+    for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+    {
+        AActor* Actor = *ActorItr;
+        if (!Actor || !Actor->GetAttachParentActor()) continue;
+
+        const FGuid UUID = GetUUIDFromActorMaterials(Actor);
+        if (UUID.IsValid())
+        {
+            RegisterTrackedActor(Actor, UUID);
+        }
+    }
+}
+
 void FAssetTrackerModule::OnActorDeleted(AActor* Actor)
 {
     if (!Actor) return;
 
-    FString UUID = GetUUIDFromActorMaterials(Actor);
-    if (!UUID.IsEmpty())
+    FGuid UUID = GetUUIDFromActorMaterials(Actor);
+    if (UUID.IsValid())
     {
-        UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s deleted — UUID: %s"),
-            *Actor->GetName(), *UUID);
+        UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s deleted — UUID: %s"),
+            *Actor->GetName(), *AssetTrackerUuidToString(UUID));
+
+        const FAssetTrackerMeta* Meta = MetaStore.Find(UUID);
+        RecordHistory(Actor, UUID, Meta ? Meta->ChatId : 0, Meta ? Meta->UserId : 0, EAssetTrackerChange::Deleted);
     }
+
+    WorldIndex.RemoveActor(*Actor);
+    PreviousActorTransforms.Remove(Actor);
 }
 
 void FAssetTrackerModule::OnMaterialUsageChanged()
 {
     UE_LOG(LogTemp, Warning, TEXT("[TrackLog] Material usage changed - scanning all actors"));
 
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+
+    // World Partition 맵은 인덱스로 집계 (언로드된 셀 포함, 로드 없음)
+    if (WorldIndex.IsBuiltFor(World))
+    {
+        TMap<FGuid, int32> Counts;
+        WorldIndex.GetUuidCounts(Counts);
+        for (const TPair<FGuid, int32>& Pair : Counts)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[TrackLog] Found AI asset usage — UUID: %s — %d actors"),
+                *AssetTrackerUuidToString(Pair.Key), Pair.Value);
+        }
+        return;
+    }
+
     // 현재 레벨의 모든 액터를 스캔
-    if (UWorld* World = GEditor->GetEditorWorldContext().World())
+    if (World)
     {
         for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
         {
             AActor* Actor = *ActorItr;
             if (Actor)
             {
-                FString UUID = GetUUIDFromActorMaterials(Actor);
-                if (!UUID.IsEmpty())
+                FGuid UUID = GetUUIDFromActorMaterials(Actor);
+                if (UUID.IsValid())
                 {
                     UE_LOG(LogTemp, Warning, TEXT("[TrackLog] Found AI asset usage in %s — UUID: %s"),
-                        *Actor->GetName(), *UUID);
+                        *Actor->GetName(), *AssetTrackerUuidToString(UUID));
                 }
             }
         }
     }
 }
 
+void FAssetTrackerModule::OnMapOpened(const FString& Filename, bool bAsTemplate)
+{
+    RebuildWorldIndex(GetWorld());
+    AnchorLoadedHierarchies(GetWorld());
+}
+
+void FAssetTrackerModule::OnEditorWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    if (WorldIndex.IsBuiltFor(World))
+    {
+        RebuildWorldIndex(nullptr);
+    }
+}
+
+void FAssetTrackerModule::RebuildWorldIndex(UWorld* World)
+{
+    if (ULevel* PrevLevel = IndexedLevel.Get())
+    {
+        PrevLevel->OnLoadedActorAddedToLevelEvent.RemoveAll(this);
+        PrevLevel->OnLoadedActorRemovedFromLevelEvent.RemoveAll(this);
+    }
+    IndexedLevel.Reset();
+    WorldIndex.Reset();
+
+    if (!World || !World->IsPartitionedWorld()) return;
+
+    WorldIndex.Build(World, MetaStore);
+
+    // 셀 로드/언로드 시 로드 상태만 갱신
+    IndexedLevel = World->PersistentLevel;
+    World->PersistentLevel->OnLoadedActorAddedToLevelEvent.AddRaw(this, &FAssetTrackerModule::OnWorldActorLoaded);
+    World->PersistentLevel->OnLoadedActorRemovedFromLevelEvent.AddRaw(this, &FAssetTrackerModule::OnWorldActorUnloaded);
+}
+
+void FAssetTrackerModule::OnWorldActorLoaded(AActor& Actor)
+{
+    WorldIndex.OnActorLoaded(Actor);
+
+    // 셀과 함께 로드된 부착 추적 액터는 조상 기준 스냅샷을 기록
+    if (Actor.GetAttachParentActor())
+    {
+        const FGuid* UUID = WorldIndex.FindUuid(Actor.GetActorGuid());
+        if (UUID && UUID->IsValid())
+        {
+            RegisterTrackedActor(&Actor, *UUID);
+        }
+    }
+}
+
+void FAssetTrackerModule::OnWorldActorUnloaded(AActor& Actor)
+{
+    WorldIndex.OnActorUnloaded(Actor);
+
+    // 언로드된 액터의 스냅샷은 유지하지 않음 (메모리는 로드된 만큼만)
+    PreviousActorTransforms.Remove(&Actor);
+}
+
+const FAssetTrackerWorldIndex& FAssetTrackerModule::GetWorldIndex() const
+{
+    return WorldIndex;
+}
+#endif
+
 void FAssetTrackerModule::LoadMetaJson()
 {
     FString JsonPath = FPaths::ProjectContentDir() / TEXT("segments.json");
@@ -231,7 +470,7 @@ void FAssetTrackerModule::LoadMetaJson()
         return;
     }
 
-    MetaMap.Empty();  // 이전 내용이 있다면 초기화
+    MetaStore.Reset(JsonArray.Num());  // 이전 내용이 있다면 초기화
 
     for (auto& EntryVal : JsonArray)
     {
@@ -262,25 +501,35 @@ void FAssetTrackerModule::LoadMetaJson()
             //    TEXT("AssetTracker: uuid=%s, chatId=%d"),
             //    *UUID, ChatId
             //);
-            FMetaEntry Entry;
-            Entry.Uuid = Obj->GetStringField(TEXT("uuid"));
-            Entry.ChatId = Obj->GetIntegerField(TEXT("chatId"));
-            Entry.UserId = Obj->GetIntegerField(TEXT("userId"));
-            MetaMap.Add(Entry.Uuid, Entry);
-            UE_LOG(LogTemp, Log,
+            // UUID는 여기서 한 번만 파싱
+            const FString UuidText = Obj->GetStringField(TEXT("uuid"));
+            const FGuid Uuid = AssetTrackerParseUuid(UuidText);
+            if (!Uuid.IsValid())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Skipping meta entry with invalid uuid '%s'"), *UuidText);
+                continue;
+            }
+
+            const int32 ChatId = Obj->GetIntegerField(TEXT("chatId"));
+            const int32 UserId = Obj->GetIntegerField(TEXT("userId"));
+            MetaStore.Add(Uuid, ChatId, UserId);
+            UE_LOG(LogTemp, Verbose,
                 TEXT("Loaded meta: uuid=%s chatId=%d userId=%d"),
-                *Entry.Uuid, Entry.ChatId, Entry.UserId);
+                *UuidText, ChatId, UserId);
         }
     }
+
+    MetaStore.Finalize();
 }
 
+#if WITH_EDITOR
 void FAssetTrackerModule::TagExistingAssets()
 {
-    if (MetaMap.Num() == 0) return;
+    if (MetaStore.Num() == 0) return;
 
     auto& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
     FARFilter Filter;
-    Filter.ClassNames.Add(UTexture2D::StaticClass()->GetFName());
+    Filter.ClassPaths.Add(UTexture2D::StaticClass()->GetClassPathName());
     Filter.PackagePaths.Add("/Game");
     Filter.bRecursivePaths = true;
 
@@ -291,14 +540,15 @@ void FAssetTrackerModule::TagExistingAssets()
     for (auto& Data : AssetList)
     {
         FString AssetName = Data.AssetName.ToString();
-        if (MetaMap.Contains(AssetName))
+        if (const FAssetTrackerMeta* Meta = MetaStore.Find(AssetTrackerParseUuid(AssetName)))
         {
-            const FMetaEntry& Entry = MetaMap[AssetName];
+            const FAssetTrackerMeta& Entry = *Meta;
+            const FString UuidText = AssetTrackerUuidToString(Entry.Uuid);
 
             UObject* AssetObj = Data.GetAsset();
             if (AssetObj)
             {
-                UEditorAssetLibrary::SetMetadataTag(AssetObj, TEXT("uuid"), Entry.Uuid);
+                UEditorAssetLibrary::SetMetadataTag(AssetObj, TEXT("uuid"), UuidText);
 
                 // chatId 태그 문자열로 저장
                 UEditorAssetLibrary::SetMetadataTag(
@@ -308,7 +558,7 @@ void FAssetTrackerModule::TagExistingAssets()
                 );
 
                 TaggedCount++;
-                UE_LOG(LogTemp, Log, TEXT("AssetTracker: Tagged existing %s →  uuid:%s, chatId:%d"), *AssetName, *Entry.Uuid, Entry.ChatId);
+                UE_LOG(LogTemp, Log, TEXT("AssetTracker: Tagged existing %s →  uuid:%s, chatId:%d"), *AssetName, *UuidText, Entry.ChatId);
 
                 // 디버깅: 태그가 제대로 설정되었는지 확인
                 FString CheckUuid = UEditorAssetLibrary::GetMetadataTag(AssetObj, TEXT("uuid"));
@@ -326,26 +576,53 @@ void FAssetTrackerModule::OnAssetImported(UFactory* Factory, UObject* CreatedObj
     if (!CreatedObject->IsA<UTexture2D>()) return;
 
     FString AssetName = CreatedObject->GetName();
-    if (MetaMap.Contains(AssetName))
+    if (const FAssetTrackerMeta* Meta = MetaStore.Find(AssetTrackerParseUuid(AssetName)))
     {   
-        const FMetaEntry& Entry = MetaMap[AssetName];
+        const FAssetTrackerMeta& Entry = *Meta;
+        const FString UuidText = AssetTrackerUuidToString(Entry.Uuid);
 
-        UEditorAssetLibrary::SetMetadataTag(CreatedObject, TEXT("uuid"), Entry.Uuid);
+        UEditorAssetLibrary::SetMetadataTag(CreatedObject, TEXT("uuid"), UuidText);
         UEditorAssetLibrary::SetMetadataTag(CreatedObject, TEXT("chatId"), FString::FromInt(Entry.ChatId));
 
-        UE_LOG(LogTemp, Log, TEXT("AssetTracker: Tagged imported %s → uuid:%s, chatId:%d"), *AssetName, *Entry.Uuid, Entry.ChatId);
+        UE_LOG(LogTemp, Log, TEXT("AssetTracker: Tagged imported %s → uuid:%s, chatId:%d"), *AssetName, *UuidText, Entry.ChatId);
+
+        // 새 태그가 붙은 텍스처를 쓰는 머티리얼 결과가 바뀔 수 있음
+        InvalidateUuidCaches();
     }
 }
 
+void FAssetTrackerModule::OnBlueprintCompiled()
+{
+    InvalidateUuidCaches();
+}
+
+void FAssetTrackerModule::InvalidateUuidCaches()
+{
+    ClassUuidCache.Invalidate();
+    InstanceTracker.InvalidateUuids();
+    PreviousActorTransforms.InvalidateUuids();
+}
+
 void FAssetTrackerModule::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
 {
     if (!Object) return;
 
-    FString ObjectClass = Object->GetClass()->GetName();
-    FString Property = PropertyChangedEvent.GetPropertyName().ToString();
+    UE_LOG(LogTemp, Verbose, TEXT(">> [Debug] Property Changed — Object: %s (%s), Property: %s"),
+        *Object->GetName(), *Object->GetClass()->GetName(), *PropertyChangedEvent.GetPropertyName().ToString());
 
-    UE_LOG(LogTemp, Log, TEXT(">> [Debug] Property Changed — Object: %s (%s), Property: %s"),
-        *Object->GetName(), *ObjectClass, *Property);
+    // 인스턴스 편집은 액터 단위로 보지 않고 다음 틱에 인스턴스 단위로 비교
+    if (UInstancedStaticMeshComponent* ISMComp = Cast<UInstancedStaticMeshComponent>(Object))
+    {
+        // 메시/머티리얼이 바뀌면 컴포넌트 UUID를 다시 해석
+        const FName PropertyName = PropertyChangedEvent.GetPropertyName();
+        if (PropertyName == GET_MEMBER_NAME_CHECKED(UMeshComponent, OverrideMaterials) ||
+            PropertyName == UStaticMeshComponent::GetMemberNameChecked_StaticMesh())
+        {
+            InstanceTracker.InvalidateUuid(ISMComp);
+        }
+        InstanceTracker.MarkDirty(ISMComp);
+        return;
+    }
 
     AActor* Actor = nullptr;
     if (Object->IsA<AActor>())
@@ -359,74 +636,290 @@ void FAssetTrackerModule::OnObjectPropertyChanged(UObject* Object, FPropertyChan
     else if (UMaterialInterface* Mat = Cast<UMaterialInterface>(Object))
     {
         // 머티리얼이 변경된 경우, 해당 머티리얼을 사용하는 모든 액터를 찾아서 로그
+        InvalidateUuidCaches();
         CheckMaterialUsageInLevel(Mat);
         return;
     }
 
     if (!Actor) return;
 
+    // 액터별 머티리얼/메시 오버라이드가 바뀌면 슬롯 UUID를 다시 해석
+    const FName PropertyName = PropertyChangedEvent.GetPropertyName();
+    if (PropertyName == GET_MEMBER_NAME_CHECKED(UMeshComponent, OverrideMaterials) ||
+        PropertyName == UStaticMeshComponent::GetMemberNameChecked_StaticMesh())
+    {
+        PreviousActorTransforms.InvalidateUuid(Actor);
+    }
+
     //FString UUID = GetUUIDFromActorMaterials(Actor);
     //if (!UUID.IsEmpty())
     //{
     //    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s changed (%s) — UUID: %s — Location: %s"),
     //        *Actor->GetName(), *Property, *UUID, *Actor->GetActorLocation().ToCompactString());
     //}
-    FString UUID = GetUUIDFromActorMaterials(Actor);
-    if (UUID.IsEmpty()) return;
+    // 부모 이동 시 하위 액터까지 한꺼번에 들어오므로 다음 틱에 계층 단위로 비교
+    MoveCoalescer.MarkDirty(Actor);
+}
 
-    // 해당 UUID에 대응하는 chatId 찾기
-    int32 ChatId = 0, UserId = 0;
-    for (const auto& Pair : MetaMap)
+bool FAssetTrackerModule::TickMoveCoalescing(float DeltaTime)
+{
+    FlushPendingMoves();
+    return true;
+}
+
+void FAssetTrackerModule::FlushPendingMoves()
+{
+    MoveCoalescer.Flush([this](AActor* Root, TArrayView<AActor* const> DirtyDescendants)
+        {
+            FlushMoveGroup(Root, DirtyDescendants);
+        });
+}
+
+void FAssetTrackerModule::FlushMoveGroup(AActor* Root, TArrayView<AActor* const> DirtyDescendants)
+{
+    TArray<AActor*> Attached;
+    Root->GetAttachedActors(Attached, true, true);
+    if (Attached.Num() == 0)
+    {
+        CheckActorTransform(Root);
+        return;
+    }
+
+    // 하위가 붙은 루트는 추적 대상이 아니어도 기준 스냅샷을 유지 (UUID 없는 슬롯은 보고되지 않음)
+    const FGuid RootUuid = GetUUIDFromActorMaterials(Root);
+    const FTransform CurrentTransform = Root->GetActorTransform();
+    FTransform LastTransform;
+    const bool bHasSnapshot = PreviousActorTransforms.Get(Root, LastTransform);
+    PreviousActorTransforms.Set(Root, CurrentTransform, RootUuid);
+
+    const uint8 ChangeMask = bHasSnapshot
+        ? FAssetTrackerTransformStore::Compare(CurrentTransform, LastTransform, AssetTracker::TransformTolerance)
+        : (uint8)EAssetTrackerTransformChange::None;
+
+    if (ChangeMask == EAssetTrackerTransformChange::None)
     {
-        const FMetaEntry& Entry = Pair.Value;
-        if (Entry.Uuid == UUID)
+        // 루트는 그대로: 나머지 dirty 액터끼리 다시 묶어서 처리
+        FAssetTrackerMoveCoalescer::GroupBySubtree(DirtyDescendants,
+            [this](AActor* SubRoot, TArrayView<AActor* const> SubDescendants)
+            {
+                FlushMoveGroup(SubRoot, SubDescendants);
+            });
+        return;
+    }
+
+    // 루트가 움직임: 하위 월드 트랜스폼은 개별 비교하지 않고 스냅샷만 무효화 (다음 접근 때 새로 기록)
+    TArray<FAssetTrackerDescendant> Descendants;
+    for (AActor* Child : Attached)
+    {
+        // 추적되지 않는 중간 기준점도 스냅샷을 무효화 (이전 위치가 남으면 다음 이동에 루트 이동량이 섞임)
+        const FGuid ChildUuid = GetCachedActorUuid(Child);
+        PreviousActorTransforms.MarkStale(Child);
+        if (!ChildUuid.IsValid()) continue;
+
+        FAssetTrackerDescendant& Descendant = Descendants.AddDefaulted_GetRef();
+        Descendant.ActorName = Child->GetFName();
+        Descendant.Uuid = ChildUuid;
+        if (const FAssetTrackerMeta* Meta = MetaStore.Find(ChildUuid))
         {
-            ChatId = Entry.ChatId;
-            UserId = Entry.UserId;
-            break;
+            Descendant.ChatId = Meta->ChatId;
+            Descendant.UserId = Meta->UserId;
         }
     }
 
+    if (Descendants.Num() == 0)
+    {
+        // 추적 하위가 없으면 일반 트랜스폼 변경
+        if (RootUuid.IsValid())
+        {
+            ReportTransformChanges(Root, RootUuid, ChangeMask, CurrentTransform);
+        }
+        return;
+    }
+
+    ReportHierarchyMove(Root, RootUuid, ChangeMask, CurrentTransform, LastTransform, MoveTemp(Descendants));
+}
+
+void FAssetTrackerModule::CheckActorTransform(AActor* Actor)
+{
+    FGuid UUID = GetUUIDFromActorMaterials(Actor);
+    if (!UUID.IsValid()) return;
+
     // Transform 변경 감지 블록 삽입
     FTransform CurrentTransform = Actor->GetActorTransform();
-    FTransform* LastTransform = PreviousActorTransforms.Find(Actor);
+    FTransform LastTransform;
 
-    if (!LastTransform)
+    if (!PreviousActorTransforms.Get(Actor, LastTransform))
     {
-        PreviousActorTransforms.Add(Actor, CurrentTransform);
+        PreviousActorTransforms.Set(Actor, CurrentTransform, UUID);
         return;
     }
 
-    const double Tolerance = 0.01;
-    bool bLocationChanged = !CurrentTransform.GetLocation().Equals(LastTransform->GetLocation(), Tolerance);
-    bool bRotationChanged = !CurrentTransform.GetRotation().Rotator().Equals(LastTransform->GetRotation().Rotator(), Tolerance);
-    bool bScaleChanged = !CurrentTransform.GetScale3D().Equals(LastTransform->GetScale3D(), Tolerance);
+    const uint8 ChangeMask = FAssetTrackerTransformStore::Compare(CurrentTransform, LastTransform, AssetTracker::TransformTolerance);
+    ReportTransformChanges(Actor, UUID, ChangeMask, CurrentTransform);
+
+    // 캐시 갱신
+    PreviousActorTransforms.Set(Actor, CurrentTransform, UUID);
+}
+
+void FAssetTrackerModule::ReportHierarchyMove(AActor* Root, const FGuid& UUID, uint8 ChangeMask, const FTransform& CurrentTransform, const FTransform& LastTransform, TArray<FAssetTrackerDescendant>&& Descendants)
+{
+    UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s hierarchy moved — UUID: %s — %d tracked descendants — Pos: %s"),
+        *Root->GetName(), UUID.IsValid() ? *AssetTrackerUuidToString(UUID) : TEXT("(untracked root)"),
+        Descendants.Num(), *CurrentTransform.GetLocation().ToCompactString());
+
+    const FAssetTrackerMeta* RootMeta = MetaStore.Find(UUID);
+    const int32 RootChatId = RootMeta ? RootMeta->ChatId : 0;
+    const int32 RootUserId = RootMeta ? RootMeta->UserId : 0;
+
+    // 전송 URL/헤더가 chatId, userId 단위이므로 하위 액터를 그 단위로 나눠 그룹마다 이벤트 하나
+    Algo::StableSortBy(Descendants, [](const FAssetTrackerDescendant& Item) { return ((int64)Item.ChatId << 32) | (uint32)Item.UserId; });
+
+    bool bRootSent = false;
+    for (int32 GroupStart = 0; GroupStart < Descendants.Num(); )
+    {
+        const int32 ChatId = Descendants[GroupStart].ChatId;
+        const int32 UserId = Descendants[GroupStart].UserId;
+        int32 GroupEnd = GroupStart + 1;
+        while (GroupEnd < Descendants.Num() && Descendants[GroupEnd].ChatId == ChatId && Descendants[GroupEnd].UserId == UserId)
+        {
+            ++GroupEnd;
+        }
+
+        // 루트 UUID는 루트와 같은 chatId/userId 그룹에만 싣고, 다른 그룹에는 추적되지 않은 루트로 보냄
+        const bool bRootGroup = UUID.IsValid() && ChatId == RootChatId && UserId == RootUserId;
+        bRootSent |= bRootGroup;
+
+        FAssetTrackerEvent Event = AssetTracker::MakeHierarchyEvent(Root, bRootGroup ? UUID : FGuid(), ChatId, UserId, ChangeMask, CurrentTransform, LastTransform);
+        Event.Descendants.Append(Descendants.GetData() + GroupStart, GroupEnd - GroupStart);
+        EventPipeline.Enqueue(MoveTemp(Event));
+
+        GroupStart = GroupEnd;
+    }
+
+    // 추적 루트와 같은 그룹의 하위가 없으면 루트만 담은 이벤트
+    if (UUID.IsValid() && !bRootSent)
+    {
+        EventPipeline.Enqueue(AssetTracker::MakeHierarchyEvent(Root, UUID, RootChatId, RootUserId, ChangeMask, CurrentTransform, LastTransform));
+    }
+}
 
-    FString TimeStr = FDateTime::UtcNow().ToIso8601();
+void FAssetTrackerModule::ReportTransformChanges(AActor* Actor, const FGuid& UUID, uint8 ChangeMask, const FTransform& CurrentTransform)
+{
+    if (ChangeMask == EAssetTrackerTransformChange::None) return;
 
-    if (bLocationChanged)
+    // 해당 UUID에 대응하는 chatId 찾기
+    int32 ChatId = 0, UserId = 0;
+    if (const FAssetTrackerMeta* Entry = MetaStore.Find(UUID))
     {
-        UE_LOG(LogTemp, Warning, TEXT("[TrackLogGG] %s location changed — UUID: %s — Pos: %s — Time: %s"),
-            *Actor->GetName(), *UUID, *CurrentTransform.GetLocation().ToCompactString(), *TimeStr);
-        SendActorTrackLog(Actor, UUID, ChatId, UserId, TEXT("RelativeLocation"));
+        ChatId = Entry->ChatId;
+        UserId = Entry->UserId;
     }
 
-    if (bRotationChanged)
+    // 캡처 경로에서는 문자열을 만들지 않음 (Verbose가 꺼져 있으면 인자도 평가되지 않음)
+    if (ChangeMask & EAssetTrackerTransformChange::Location)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s rotation changed — UUID: %s — Rot: %s — Time: %s"),
-            *Actor->GetName(), *UUID, *CurrentTransform.GetRotation().Rotator().ToCompactString(), *TimeStr);
-        SendActorTrackLog(Actor, UUID, ChatId, UserId, TEXT("RelativeRotation"));
+        UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s location changed — UUID: %s — Pos: %s"),
+            *Actor->GetName(), *AssetTrackerUuidToString(UUID), *CurrentTransform.GetLocation().ToCompactString());
+        SendActorTrackLog(Actor, UUID, ChatId, UserId, EAssetTrackerChange::Location);
     }
 
-    if (bScaleChanged)
+    if (ChangeMask & EAssetTrackerTransformChange::Rotation)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[TrackLog] %s scale changed — UUID: %s — Scale: %s — Time: %s"),
-            *Actor->GetName(), *UUID, *CurrentTransform.GetScale3D().ToCompactString(), *TimeStr);
-        SendActorTrackLog(Actor, UUID, ChatId, UserId, TEXT("RelativeScale3D"));
+        UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s rotation changed — UUID: %s — Rot: %s"),
+            *Actor->GetName(), *AssetTrackerUuidToString(UUID), *CurrentTransform.GetRotation().Rotator().ToCompactString());
+        SendActorTrackLog(Actor, UUID, ChatId, UserId, EAssetTrackerChange::Rotation);
     }
 
-    // 캐시 갱신
-    PreviousActorTransforms[Actor] = CurrentTransform;
+    if (ChangeMask & EAssetTrackerTransformChange::Scale)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s scale changed — UUID: %s — Scale: %s"),
+            *Actor->GetName(), *AssetTrackerUuidToString(UUID), *CurrentTransform.GetScale3D().ToCompactString());
+        SendActorTrackLog(Actor, UUID, ChatId, UserId, EAssetTrackerChange::Scale);
+    }
+}
+
+void FAssetTrackerModule::OnObjectModified(UObject* Object)
+{
+    // Modify()는 편집 전에 호출되므로 여기서 기준 스냅샷을 찍음
+    if (UInstancedStaticMeshComponent* ISMComp = Cast<UInstancedStaticMeshComponent>(Object))
+    {
+        InstanceTracker.BeginEdit(ISMComp, [this](UInstancedStaticMeshComponent* Component) { return ResolveInstanceComponentUuid(Component); });
+    }
+}
+
+void FAssetTrackerModule::OnPreObjectPropertyChanged(UObject* Object, const FEditPropertyChain& PropertyChain)
+{
+    // 트랜잭션 없이 디테일 패널에서 바뀌는 경우
+    OnObjectModified(Object);
+}
+
+FGuid FAssetTrackerModule::ResolveInstanceComponentUuid(UInstancedStaticMeshComponent* Component)
+{
+    // 컴포넌트당 한 번만 호출됨
+    for (int32 i = 0; i < Component->GetNumMaterials(); ++i)
+    {
+        FGuid UUID = ClassUuidCache.ResolveMaterial(Component->GetMaterial(i),
+            [this](UMaterialInterface* Mat) { return GetUUIDFromMaterial(Mat); });
+        if (UUID.IsValid())
+        {
+            return UUID;
+        }
+    }
+    return FGuid();
+}
+
+bool FAssetTrackerModule::TickInstanceTracking(float DeltaTime)
+{
+    InstanceTracker.Flush(
+        [this](UInstancedStaticMeshComponent* Component) { return ResolveInstanceComponentUuid(Component); },
+        [this](UInstancedStaticMeshComponent* Component, const FGuid& UUID, TArrayView<const FAssetTrackerInstanceDelta> Deltas)
+        {
+            AActor* Owner = Component->GetOwner();
+            if (!Owner) return;
+
+            UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s.%s instances changed — UUID: %s — %d instances"),
+                *Owner->GetName(), *Component->GetName(), *AssetTrackerUuidToString(UUID), Deltas.Num());
+
+            const FAssetTrackerMeta* Meta = MetaStore.Find(UUID);
+
+            FAssetTrackerEvent Event;
+            Event.TimestampTicks = FDateTime::UtcNow().GetTicks();
+            Event.ActorName = Owner->GetFName();
+            Event.WorldPackage = Owner->GetOutermost()->GetFName();
+            Event.ChatId = Meta ? Meta->ChatId : 0;
+            Event.UserId = Meta ? Meta->UserId : 0;
+            Event.Change = EAssetTrackerChange::Instances;
+            Event.Uuid = UUID;
+            Event.ComponentName = Component->GetFName();
+            Event.Instances.Append(Deltas.GetData(), Deltas.Num());
+            EventPipeline.Enqueue(MoveTemp(Event));
+        });
+    return true;
+}
+
+bool FAssetTrackerModule::TickReconciliation(float DeltaTime)
+{
+    if (!AssetTracker::bEnableReconciliation) return true;
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now < NextReconcileSweepTime) return true;
+
+    // 이번 틱의 이동을 먼저 계층 단위로 보고 (스윕이 먼저 돌면 루트 기준점만 갱신하고 하위를 개별 보고함)
+    FlushPendingMoves();
+
+    // 델리게이트가 놓친 변경 (Python, Sequencer 베이크, 스냅 도구, 일괄 작업 등)
+    const bool bSweepDone = PreviousActorTransforms.ReconcileSlice(AssetTracker::ReconcileActorsPerTick, AssetTracker::TransformTolerance,
+        [this](AActor* Actor, const FGuid& UUID, uint8 ChangeMask, const FTransform& CurrentTransform)
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] Reconciliation found untracked change on %s"), *Actor->GetName());
+            ReportTransformChanges(Actor, UUID, ChangeMask, CurrentTransform);
+        });
+
+    if (bSweepDone)
+    {
+        NextReconcileSweepTime = Now + AssetTracker::ReconcileInterval;
+    }
+    return true;
 }
 
 void FAssetTrackerModule::CheckMaterialUsageInLevel(UMaterialInterface* Material)
@@ -434,10 +927,10 @@ void FAssetTrackerModule::CheckMaterialUsageInLevel(UMaterialInterface* Material
     if (!Material) return;
 
     // 해당 머티리얼이 AI 에셋을 사용하는지 확인
-    FString UUID = GetUUIDFromMaterial(Material);
-    if (UUID.IsEmpty()) return;
+    FGuid UUID = GetUUIDFromMaterial(Material);
+    if (!UUID.IsValid()) return;
 
-    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] Material %s (UUID: %s) was modified"), *Material->GetName(), *UUID);
+    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] Material %s (UUID: %s) was modified"), *Material->GetName(), *AssetTrackerUuidToString(UUID));
 
     // MaterialInstance 검사
     if (UMaterialInstance* MatInst = Cast<UMaterialInstance>(Material))
@@ -525,17 +1018,18 @@ bool FAssetTrackerModule::IsActorUsingMaterial(AActor* Actor, UMaterialInterface
     return false;
 }
 
-FString FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
+FGuid FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
 {
-    if (!Material) return FString();
+    if (!Material) return FGuid();
 
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] GetUUIDFromMaterial: Analyzing material: %s (%s)"),
+    // 쿠킹 시 /Game 머티리얼 전체에 대해 호출되므로 디버그 출력은 Verbose
+    UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] GetUUIDFromMaterial: Analyzing material: %s (%s)"),
         *Material->GetName(), *Material->GetClass()->GetName());
 
     // ① MaterialInstance 먼저 검사
     if (UMaterialInstance* MatInst = Cast<UMaterialInstance>(Material))
     {
-        UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] → Checking as MaterialInstance"));
+        UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] → Checking as MaterialInstance"));
 
         TArray<FMaterialParameterInfo> ParamInfos;
         TArray<FGuid> ParamGuids;
@@ -546,11 +1040,12 @@ FString FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
             UTexture* Tex = nullptr;
             if (MatInst->GetTextureParameterValue(Info, Tex) && Tex)
             {
-                FString UUID = UEditorAssetLibrary::GetMetadataTag(Tex, TEXT("uuid"));
-                if (!UUID.IsEmpty())
+                FString Tag = UEditorAssetLibrary::GetMetadataTag(Tex, TEXT("uuid"));
+                FGuid UUID = AssetTrackerParseUuid(Tag);
+                if (UUID.IsValid())
                 {
-                    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] ✅ Found UUID %s in MaterialInstance %s via param %s"),
-                        *UUID, *MatInst->GetName(), *Info.Name.ToString());
+                    UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] ✅ Found UUID %s in MaterialInstance %s via param %s"),
+                        *Tag, *MatInst->GetName(), *Info.Name.ToString());
                     return UUID;
                 }
             }
@@ -558,17 +1053,18 @@ FString FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
     }
 
     // ② Base Material에서 GetUsedTextures 시도
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] → Checking as base Material"));
+    UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] → Checking as base Material"));
 
     TArray<UTexture*> Textures;
     Material->GetUsedTextures(Textures, EMaterialQualityLevel::High, true, ERHIFeatureLevel::SM5, false);
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Found %d used textures"), Textures.Num());
+    UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] Found %d used textures"), Textures.Num());
 
     for (UTexture* Tex : Textures)
     {
-        FString UUID = UEditorAssetLibrary::GetMetadataTag(Tex, TEXT("uuid"));
-        UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] - UsedTexture: %s → %s"), *Tex->GetName(), *UUID);
-        if (!UUID.IsEmpty())
+        FString Tag = UEditorAssetLibrary::GetMetadataTag(Tex, TEXT("uuid"));
+        UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] - UsedTexture: %s → %s"), *Tex->GetName(), *Tag);
+        FGuid UUID = AssetTrackerParseUuid(Tag);
+        if (UUID.IsValid())
         {
             return UUID;
         }
@@ -578,7 +1074,7 @@ FString FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
 #if WITH_EDITOR
     if (UMaterial* BaseMat = Cast<UMaterial>(Material))
     {
-        UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] → Scanning Expressions (manual)"));
+        UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] → Scanning Expressions (manual)"));
 
         UMaterialEditorOnlyData* EditorOnlyData = BaseMat->GetEditorOnlyData();
         if (EditorOnlyData)
@@ -590,10 +1086,11 @@ FString FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
                     UTexture* Tex = TextureSample->Texture;
                     if (Tex)
                     {
-                        FString UUID = UEditorAssetLibrary::GetMetadataTag(Tex, TEXT("uuid"));
-                        UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] - Expression Texture: %s → %s"), *Tex->GetName(), *UUID);
+                        FString Tag = UEditorAssetLibrary::GetMetadataTag(Tex, TEXT("uuid"));
+                        UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] - Expression Texture: %s → %s"), *Tex->GetName(), *Tag);
 
-                        if (!UUID.IsEmpty())
+                        FGuid UUID = AssetTrackerParseUuid(Tag);
+                        if (UUID.IsValid())
                         {
                             return UUID;
                         }
@@ -604,86 +1101,36 @@ FString FAssetTrackerModule::GetUUIDFromMaterial(UMaterialInterface* Material)
     }
 #endif
 
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] ❌ No UUID found in material: %s"), *Material->GetName());
-    return FString();
+    UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] ❌ No UUID found in material: %s"), *Material->GetName());
+    return FGuid();
 }
 
 
-FString FAssetTrackerModule::GetUUIDFromActorMaterials(AActor* Actor)
+FGuid FAssetTrackerModule::GetUUIDFromActorMaterials(AActor* Actor)
 {
-    if (!Actor)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Actor is null"));
-        return FString();
-    }
-
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Analyzing actor: %s"), *Actor->GetName());
+    if (!Actor) return FGuid();
 
-    // StaticMeshActor 우선 처리
-    if (AStaticMeshActor* SMActor = Cast<AStaticMeshActor>(Actor))
-    {
-        if (UStaticMeshComponent* SMComp = SMActor->GetStaticMeshComponent())
-        {
-            int32 MaterialCount = SMComp->GetNumMaterials();
-            UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] StaticMeshComponent has %d materials"), MaterialCount);
+    // 클래스 템플릿 결과 재사용, 인스턴스별 오버라이드 머티리얼만 직접 해석
+    FGuid UUID = ClassUuidCache.Resolve(Actor,
+        [this](UMaterialInterface* Mat) { return GetUUIDFromMaterial(Mat); });
 
-            for (int i = 0; i < MaterialCount; ++i)
-            {
-                UMaterialInterface* Mat = SMComp->GetMaterial(i);
-                if (!Mat)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Material %d is null"), i);
-                    continue;
-                }
+    UE_LOG(LogTemp, Verbose, TEXT("[UUID DEBUG] %s -> %s"), *Actor->GetName(), UUID.IsValid() ? *AssetTrackerUuidToString(UUID) : TEXT("(none)"));
+    return UUID;
+}
 
-                UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Checking StaticMesh material %d: %s (%s)"),
-                    i, *Mat->GetName(), *Mat->GetClass()->GetName());
 
-                FString UUID = GetUUIDFromMaterial(Mat);
-                if (!UUID.IsEmpty())
-                {
-                    return UUID;
-                }
-            }
-        }
-    }
-
-    // 기타 모든 MeshComponent 탐색
-    TArray<UActorComponent*> Components = Actor->GetComponents().Array();
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Actor has %d components"), Components.Num());
+FGuid FAssetTrackerModule::GetCachedActorUuid(AActor* Actor)
+{
+    FGuid UUID;
+    if (PreviousActorTransforms.FindUuid(Actor, UUID)) return UUID;
 
-    for (UActorComponent* Comp : Components)
+    // 추적 대상이 아닌 액터도 무효 UUID로 기록해서 다음 루트 이동 때 다시 해석하지 않음
+    UUID = GetUUIDFromActorMaterials(Actor);
+    if (!PreviousActorTransforms.SetUuid(Actor, UUID))
     {
-        UMeshComponent* Mesh = Cast<UMeshComponent>(Comp);
-        if (!Mesh) continue;
-
-        int32 MatCount = Mesh->GetNumMaterials();
-        UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] MeshComponent: %s has %d materials"), *Mesh->GetName(), MatCount);
-
-        for (int i = 0; i < MatCount; ++i)
-        {
-            UMaterialInterface* Mat = Mesh->GetMaterial(i);
-            if (!Mat)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Material %d is null"), i);
-                continue;
-            }
-
-            UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] Checking material %d: %s (%s)"),
-                i, *Mat->GetName(), *Mat->GetClass()->GetName());
-
-            FString UUID = GetUUIDFromMaterial(Mat);
-            if (!UUID.IsEmpty())
-            {
-                UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] ✅ UUID found in actor %s: %s"),
-                    *Actor->GetName(), *UUID);
-                return UUID;
-            }
-        }
+        PreviousActorTransforms.Set(Actor, Actor->GetActorTransform(), UUID);
     }
-
-    UE_LOG(LogTemp, Warning, TEXT("[UUID DEBUG] ❌ No UUID found for actor: %s"), *Actor->GetName());
-    return FString();
+    return UUID;
 }
 
 
@@ -696,108 +1143,222 @@ UWorld* FAssetTrackerModule::GetWorld() const
     return nullptr;
 }
 
-void FAssetTrackerModule::SendActorTrackLog(AActor* Actor, const FString& UUID, int32 ChatId, int32 UserId, const FString& Property)
+void FAssetTrackerModule::BakeUuidTable(TArray<FString>& ExtraPackagesToCook)
 {
-    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] Enter: %s / %s / %d / %s"),
-        *Actor->GetName(), *UUID, ChatId, *Property);
+    PreviousCookModificationDelegate.ExecuteIfBound(ExtraPackagesToCook);
+
+    UPackage* Package = CreatePackage(UAssetTrackerUuidTable::PackageName);
+    const FName AssetName = FName(*FPackageName::GetShortName(UAssetTrackerUuidTable::PackageName));
 
-    if (!Actor || UUID.IsEmpty()) return;
+    UAssetTrackerUuidTable* Table = FindObject<UAssetTrackerUuidTable>(Package, *AssetName.ToString());
+    const bool bCreated = (Table == nullptr);
+    if (bCreated)
+    {
+        Table = NewObject<UAssetTrackerUuidTable>(Package, AssetName, RF_Public | RF_Standalone);
+    }
+    Table->Reset();
 
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-    JsonObject->SetStringField("actorName", Actor->GetName());
-    JsonObject->SetStringField("uuid", UUID);
-    JsonObject->SetNumberField(TEXT("chatId"), ChatId);
-    JsonObject->SetStringField("changeType", Property);
+    auto& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-    // 변경 시간 (ISO 8601 형식)
-    FString Timestamp = FDateTime::UtcNow().ToIso8601();
-    JsonObject->SetStringField("timestamp", Timestamp);
+    // 런타임은 메시 머티리얼 체인만 조회하므로 머티리얼만 굽는다 (텍스처 UUID는 GetUUIDFromMaterial이 해석)
+    FARFilter MaterialFilter;
+    MaterialFilter.ClassPaths.Add(UMaterialInterface::StaticClass()->GetClassPathName());
+    MaterialFilter.PackagePaths.Add("/Game");
+    MaterialFilter.bRecursivePaths = true;
+    MaterialFilter.bRecursiveClasses = true;
 
-    TArray<TSharedPtr<FJsonValue>> JsonArray;
-    JsonArray.Add(MakeShareable(new FJsonValueObject(JsonObject)));
+    TArray<FAssetData> Materials;
+    AssetRegistry.GetAssets(MaterialFilter, Materials);
 
-   /* if (Property == "RelativeLocation")
+    for (const FAssetData& Data : Materials)
     {
-       FVector Loc = Actor->GetActorLocation();
-        TSharedPtr<FJsonObject> LocObj = MakeShareable(new FJsonObject);
-        LocObj->SetNumberField("x", Loc.X);
-        LocObj->SetNumberField("y", Loc.Y);
-        LocObj->SetNumberField("z", Loc.Z);
-        JsonObject->SetObjectField("location", LocObj);
+        UMaterialInterface* Material = Cast<UMaterialInterface>(Data.GetAsset());
+        FGuid UUID = GetUUIDFromMaterial(Material);
+        if (!UUID.IsValid()) continue;
+
+        FAssetTrackerBakedEntry Entry;
+        Entry.Uuid = UUID;
+        if (const FAssetTrackerMeta* Meta = MetaStore.Find(UUID))
+        {
+            Entry.ChatId = Meta->ChatId;
+            Entry.UserId = Meta->UserId;
+        }
+        Table->Add(Data.GetSoftObjectPath(), Entry);
     }
-    else if (Property == "RelativeRotation")
+
+    Table->Finalize();
+
+    const FString Filename = FPackageName::LongPackageNameToFilename(UAssetTrackerUuidTable::PackageName, FPackageName::GetAssetPackageExtension());
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    Package->MarkPackageDirty();
+    if (!UPackage::SavePackage(Package, Table, *Filename, SaveArgs))
     {
-        FRotator Rot = Actor->GetActorRotation();
-        TSharedPtr<FJsonObject> RotObj = MakeShareable(new FJsonObject);
-        RotObj->SetNumberField("pitch", Rot.Pitch);
-        RotObj->SetNumberField("yaw", Rot.Yaw);
-        RotObj->SetNumberField("roll", Rot.Roll);
-        JsonObject->SetObjectField("rotation", RotObj);
+        UE_LOG(LogTemp, Error, TEXT("AssetTracker: Failed to save UUID table to %s"), *Filename);
+        return;
     }
-    else if (Property == "RelativeScale3D")
+
+    if (bCreated)
     {
-        FVector Scale = Actor->GetActorScale3D();
-        TSharedPtr<FJsonObject> ScaleObj = MakeShareable(new FJsonObject);
-        ScaleObj->SetNumberField("x", Scale.X);
-        ScaleObj->SetNumberField("y", Scale.Y);
-        ScaleObj->SetNumberField("z", Scale.Z);
-        JsonObject->SetObjectField("scale", ScaleObj);
-    }*/
+        FAssetRegistryModule::AssetCreated(Table);
+    }
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonArray, Writer);
-    //FJsonSerializer::Serialize(JsonObject, Writer);
+    ExtraPackagesToCook.AddUnique(UAssetTrackerUuidTable::PackageName);
 
+    UE_LOG(LogTemp, Display, TEXT("AssetTracker: Baked UUID table - %d assets (%d materials scanned)"),
+        Table->Num(), Materials.Num());
+}
+#endif
 
+void FAssetTrackerModule::LoadBakedUuidTable()
+{
+    UAssetTrackerUuidTable* Table = LoadObject<UAssetTrackerUuidTable>(nullptr, UAssetTrackerUuidTable::ObjectPath);
+    if (!Table)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Baked UUID table not found (%s)"), UAssetTrackerUuidTable::ObjectPath);
+        return;
+    }
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    BakedUuidTable.Reset(Table);
+    RuntimeUsageCounts.Init(0, Table->NumEntries());
+    RuntimeUploadedEntries.Init(false, Table->NumEntries());
+    UE_LOG(LogTemp, Log, TEXT("AssetTracker: Baked UUID table loaded, %d assets"), Table->Num());
+}
 
-    FString Url = FString::Printf(TEXT("http://13.125.77.82:8080/api/v1/unreal-history/%d"), ChatId);  // TODO : 나중에 /%d 전까지 배포 주소로 수정
-    //Request->SetURL(TEXT("https://httpbin.org/post"));
-    Request->SetURL(Url);
-    //Request->SetURL(TEXT("http://localhost:8080/api/v1/unreal-history/{chatId}"));
-    Request->SetVerb("POST");
-    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetHeader(TEXT("userId"), FString::FromInt(UserId));
+void FAssetTrackerModule::OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS)
+{
+    if (!World || !World->IsGameWorld() || !BakedUuidTable.IsValid()) return;
 
-    Request->SetContentAsString(OutputString);
+    FDelegateHandle Handle = World->AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateRaw(this, &FAssetTrackerModule::OnRuntimeActorSpawned));
+    ActorSpawnedHandles.Add(World, Handle);
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("[TrackLog] JSON Sent: %s"), *OutputString);
-    //UE_LOG(LogTemp, Warning, TEXT("[TrackLog] POST to %s"), *Url);
+void FAssetTrackerModule::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    FDelegateHandle Handle;
+    if (ActorSpawnedHandles.RemoveAndCopyValue(World, Handle))
+    {
+        World->RemoveOnActorSpawnedHandler(Handle);
+    }
+
+    // 플레이 세션 종료 시 집계 요약 출력 후 업로드 게이트 초기화
+    if (bSessionEnded && BakedUuidTable.IsValid())
+    {
+        for (int32 EntryIndex = 0; EntryIndex < RuntimeUsageCounts.Num(); ++EntryIndex)
+        {
+            if (RuntimeUsageCounts[EntryIndex] > 0)
+            {
+                UE_LOG(LogTemp, Log, TEXT("[TrackLog] Runtime usage - UUID: %s, spawns: %d"),
+                    *AssetTrackerUuidToString(BakedUuidTable->GetEntry(EntryIndex).Uuid), RuntimeUsageCounts[EntryIndex]);
+            }
+        }
+        RuntimeUploadedEntries.Init(false, RuntimeUploadedEntries.Num());
+    }
+}
+
+void FAssetTrackerModule::OnRuntimeActorSpawned(AActor* Actor)
+{
+    const int32 EntryIndex = FindBakedEntryForActor(Actor);
+    if (EntryIndex == INDEX_NONE) return;
 
-    Request->OnProcessRequestComplete().BindRaw(this, &FAssetTrackerModule::OnHttpResponse);
+    // 스폰 경로는 카운트만. 업로드는 세션당 UUID별 첫 스폰 한 번
+    RuntimeUsageCounts[EntryIndex]++;
+    if (RuntimeUploadedEntries[EntryIndex]) return;
+    RuntimeUploadedEntries[EntryIndex] = true;
 
-    Request->ProcessRequest();
+    const FAssetTrackerBakedEntry& Entry = BakedUuidTable->GetEntry(EntryIndex);
+    UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] %s spawned — UUID: %s"), *Actor->GetName(), *AssetTrackerUuidToString(Entry.Uuid));
+    SendActorTrackLog(Actor, Entry.Uuid, Entry.ChatId, Entry.UserId, EAssetTrackerChange::Spawned);
 }
 
-// 콜백 함수
-void FAssetTrackerModule::OnHttpResponse(
-    FHttpRequestPtr Request,
-    FHttpResponsePtr Response,
-    bool bWasSuccessful
-)
+int32 FAssetTrackerModule::FindBakedEntryForActor(AActor* Actor) const
 {
-    if (bWasSuccessful && Response.IsValid())
+    if (!Actor || !BakedUuidTable.IsValid()) return INDEX_NONE;
+
+    TInlineComponentArray<UMeshComponent*> Meshes(Actor);
+    for (UMeshComponent* Mesh : Meshes)
     {
-        UE_LOG(LogTemp, Log, TEXT("HTTP Success: %d %s"),
-            Response->GetResponseCode(),
-            *Response->GetContentAsString());
+        const int32 MatCount = Mesh->GetNumMaterials();
+        for (int32 i = 0; i < MatCount; ++i)
+        {
+            // MID 등 런타임 인스턴스는 쿠킹된 부모까지 거슬러 올라감
+            for (UMaterialInterface* Mat = Mesh->GetMaterial(i); Mat; )
+            {
+                const int32 EntryIndex = BakedUuidTable->FindEntryIndex(Mat);
+                if (EntryIndex != INDEX_NONE)
+                {
+                    return EntryIndex;
+                }
+
+                UMaterialInstance* MatInst = Cast<UMaterialInstance>(Mat);
+                Mat = MatInst ? MatInst->Parent.Get() : nullptr;
+            }
+        }
     }
-    else
+    return INDEX_NONE;
+}
+
+TMap<FGuid, int32> FAssetTrackerModule::GetRuntimeUsageCounts() const
+{
+    TMap<FGuid, int32> Counts;
+    if (!BakedUuidTable.IsValid()) return Counts;
+
+    for (int32 EntryIndex = 0; EntryIndex < RuntimeUsageCounts.Num(); ++EntryIndex)
     {
-        UE_LOG(LogTemp, Error, TEXT("HTTP Failed"));
+        if (RuntimeUsageCounts[EntryIndex] > 0)
+        {
+            Counts.Add(BakedUuidTable->GetEntry(EntryIndex).Uuid, RuntimeUsageCounts[EntryIndex]);
+        }
     }
+    return Counts;
+}
+
+void FAssetTrackerModule::SendActorTrackLog(AActor* Actor, const FGuid& UUID, int32 ChatId, int32 UserId, EAssetTrackerChange Change)
+{
+    if (!Actor || !UUID.IsValid()) return;
+
+    UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] Enter: %s / %s / %d / %s"),
+        *Actor->GetName(), *AssetTrackerUuidToString(UUID), ChatId, LexToString(Change));
+
+    CaptureEvent(Actor, UUID, ChatId, UserId, Change, true);
+}
 
-    // 응답 상태 코드 가져옴
-    int32 StatusCode = Response->GetResponseCode();
+void FAssetTrackerModule::RecordHistory(AActor* Actor, const FGuid& UUID, int32 ChatId, int32 UserId, EAssetTrackerChange Change)
+{
+    CaptureEvent(Actor, UUID, ChatId, UserId, Change, false);
+}
+
+void FAssetTrackerModule::CaptureEvent(AActor* Actor, const FGuid& UUID, int32 ChatId, int32 UserId, EAssetTrackerChange Change, bool bUpload)
+{
+    // 게임 스레드에서는 POD 캡처만, 직렬화/전송/이력 기록은 워커에서
+    FAssetTrackerEvent Event;
+    Event.TimestampTicks = FDateTime::UtcNow().GetTicks();
+    Event.ActorName = Actor->GetFName();
+    Event.WorldPackage = Actor->GetOutermost()->GetFName();
+    Event.ChatId = ChatId;
+    Event.UserId = UserId;
+    Event.Change = Change;
+    Event.bUpload = bUpload;
+    Event.Uuid = UUID;
+    EventPipeline.Enqueue(MoveTemp(Event));
+}
 
-    // 응답 본문을 문자열로 가져옴
-    FString ResponseContent = Response->GetContentAsString();
+TArray<FAssetTrackerHistoryRecord> FAssetTrackerModule::GetUuidTimeline(const FGuid& UUID, const FDateTime& From, const FDateTime& To) const
+{
+    TArray<FAssetTrackerHistoryRecord> Records;
+    History.QueryUuid(UUID, From, To, Records);
+    return Records;
+}
 
-    // 요청이 완료되었음을 출력
-    UE_LOG(LogTemp, Warning, TEXT("HTTP request completed. Status Code: %d, URL: %s"), StatusCode, *Request->GetURL());
-    UE_LOG(LogTemp, Warning, TEXT("Response Content: %s"), *ResponseContent);
+TArray<FAssetTrackerHistoryRecord> FAssetTrackerModule::GetActorTimeline(const AActor* Actor, const FDateTime& From, const FDateTime& To) const
+{
+    TArray<FAssetTrackerHistoryRecord> Records;
+    if (Actor)
+    {
+        History.QueryActor(FAssetTrackerHistoryRecord::MakeActorKey(Actor->GetOutermost()->GetFName(), Actor->GetFName()), From, To, Records);
+    }
+    return Records;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerClassUuidCache.h"
+#include "Components/MeshComponent.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+
+void FAssetTrackerClassUuidCache::Invalidate()
+{
+    PrecomputedClasses.Empty();
+    Templates.Empty();
+    MaterialUuids.Empty();
+}
+
+FGuid FAssetTrackerClassUuidCache::ResolveMaterial(UMaterialInterface* Material, FResolveMaterial Resolver)
+{
+    if (!Material) return FGuid();
+
+    if (const FGuid* Cached = MaterialUuids.Find(Material))
+    {
+        return *Cached;
+    }
+    return MaterialUuids.Add(Material, Resolver(Material));
+}
+
+FGuid FAssetTrackerClassUuidCache::ResolveComponent(const UMeshComponent* Component, FResolveMaterial Resolver)
+{
+    const int32 MatCount = Component->GetNumMaterials();
+    for (int32 i = 0; i < MatCount; ++i)
+    {
+        FGuid UUID = ResolveMaterial(Component->GetMaterial(i), Resolver);
+        if (UUID.IsValid())
+        {
+            return UUID;
+        }
+    }
+    return FGuid();
+}
+
+const FAssetTrackerClassUuidCache::FTemplateInfo& FAssetTrackerClassUuidCache::GetTemplateInfo(const UMeshComponent* Template, FResolveMaterial Resolver)
+{
+    if (const FTemplateInfo* Existing = Templates.Find(Template))
+    {
+        return *Existing;
+    }
+
+    FTemplateInfo Info;
+    const int32 MatCount = Template->GetNumMaterials();
+    Info.Materials.Reserve(MatCount);
+    for (int32 i = 0; i < MatCount; ++i)
+    {
+        Info.Materials.Add(Template->GetMaterial(i));
+    }
+    Info.Uuid = ResolveComponent(Template, Resolver);
+
+    return Templates.Add(Template, MoveTemp(Info));
+}
+
+void FAssetTrackerClassUuidCache::PrecomputeClass(UClass* Class, FResolveMaterial Resolver)
+{
+    // 네이티브 기본 서브오브젝트
+    if (AActor* CDO = Cast<AActor>(Class->GetDefaultObject()))
+    {
+        TInlineComponentArray<UMeshComponent*> DefaultMeshes(CDO);
+        for (UMeshComponent* Mesh : DefaultMeshes)
+        {
+            GetTemplateInfo(Mesh, Resolver);
+        }
+    }
+
+    // 부모 블루프린트까지 포함한 SCS 컴포넌트 템플릿
+    TArray<const UBlueprintGeneratedClass*> GeneratedClasses;
+    UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(Class, GeneratedClasses);
+    for (const UBlueprintGeneratedClass* GeneratedClass : GeneratedClasses)
+    {
+        if (!GeneratedClass->SimpleConstructionScript) continue;
+
+        for (const USCS_Node* Node : GeneratedClass->SimpleConstructionScript->GetAllNodes())
+        {
+            if (const UMeshComponent* Template = Node ? Cast<UMeshComponent>(Node->ComponentTemplate) : nullptr)
+            {
+                GetTemplateInfo(Template, Resolver);
+            }
+        }
+    }
+
+    PrecomputedClasses.Add(Class);
+}
+
+FGuid FAssetTrackerClassUuidCache::Resolve(AActor* Actor, FResolveMaterial Resolver)
+{
+    if (!Actor) return FGuid();
+
+    UClass* Class = Actor->GetClass();
+    if (!PrecomputedClasses.Contains(Class))
+    {
+        PrecomputeClass(Class, Resolver);
+    }
+
+    TInlineComponentArray<UMeshComponent*> Meshes(Actor);
+    for (UMeshComponent* Mesh : Meshes)
+    {
+        // 인스턴스 컴포넌트의 아키타입 = CDO 서브오브젝트 또는 SCS/상속 오버라이드 템플릿
+        const UMeshComponent* Template = Cast<UMeshComponent>(Mesh->GetArchetype());
+
+        bool bMatchesTemplate = false;
+        const FTemplateInfo* Info = nullptr;
+        if (Template && !Template->HasAnyFlags(RF_ClassDefaultObject))
+        {
+            Info = &GetTemplateInfo(Template, Resolver);
+
+            const int32 MatCount = Mesh->GetNumMaterials();
+            bMatchesTemplate = (MatCount == Info->Materials.Num());
+            for (int32 i = 0; bMatchesTemplate && i < MatCount; ++i)
+            {
+                bMatchesTemplate = (Mesh->GetMaterial(i) == Info->Materials[i].Get());
+            }
+        }
+
+        // 템플릿 그대로면 클래스 결과, 아니면 오버라이드된 머티리얼만 직접 해석
+        FGuid UUID = bMatchesTemplate ? Info->Uuid : ResolveComponent(Mesh, Resolver);
+        if (UUID.IsValid())
+        {
+            return UUID;
+        }
+    }
+    return FGuid();
+}
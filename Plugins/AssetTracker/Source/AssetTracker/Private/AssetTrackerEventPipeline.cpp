@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerEventPipeline.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+
+namespace AssetTrackerEventPipeline
+{
+    // 게임 스레드에서 이벤트마다 깨우지 않고 워커가 주기적으로 비움
+    constexpr uint32 FlushIntervalMs = 20;
+}
+
+FAssetTrackerEventPipeline::~FAssetTrackerEventPipeline()
+{
+    Shutdown();
+}
+
+void FAssetTrackerEventPipeline::AddSink(TUniquePtr<IAssetTrackerEventSink> Sink)
+{
+    // 워커는 잠금 없이 목록을 읽으므로 시작 전에만 등록
+    check(!Thread);
+    if (Sink)
+    {
+        Sinks.Add(MoveTemp(Sink));
+    }
+}
+
+void FAssetTrackerEventPipeline::Start()
+{
+    if (Thread) return;
+
+    bStopping = false;
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("AssetTrackerEventPipeline"), 0, TPri_BelowNormal);
+}
+
+void FAssetTrackerEventPipeline::Shutdown()
+{
+    if (!Thread) return;
+
+    Thread->Kill(true);
+    delete Thread;
+    Thread = nullptr;
+
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+
+    // 종료 직전에 들어온 이벤트는 로컬에만 기록 (모듈 종료 중에 HTTP 요청을 만들지 않음)
+    ProcessPending(true);
+
+    Sinks.Empty();
+}
+
+void FAssetTrackerEventPipeline::Stop()
+{
+    bStopping = true;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FAssetTrackerEventPipeline::Enqueue(FAssetTrackerEvent&& Event)
+{
+    PendingEvents.Enqueue(MoveTemp(Event));
+}
+
+uint32 FAssetTrackerEventPipeline::Run()
+{
+    while (!bStopping)
+    {
+        WakeEvent->Wait(AssetTrackerEventPipeline::FlushIntervalMs);
+        ProcessPending(false);
+    }
+    return 0;
+}
+
+void FAssetTrackerEventPipeline::ProcessPending(bool bLocalOnly)
+{
+    Batch.Reset();
+
+    FAssetTrackerEvent Event;
+    while (PendingEvents.Dequeue(Event))
+    {
+        Batch.Add(MoveTemp(Event));
+    }
+    if (Batch.Num() == 0) return;
+
+    for (const TUniquePtr<IAssetTrackerEventSink>& Sink : Sinks)
+    {
+        if (Sink->IsEnabled() && (!bLocalOnly || Sink->IsLocal()))
+        {
+            Sink->Consume(Batch);
+        }
+    }
+}
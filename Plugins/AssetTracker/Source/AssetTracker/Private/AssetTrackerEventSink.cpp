@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerEventSink.h"
+
+void AssetTrackerEventToRecords(const FAssetTrackerEvent& Event, FString& NameScratch, TArray<FAssetTrackerHistoryRecord>& OutRecords)
+{
+    FAssetTrackerHistoryRecord Record;
+    Record.TimestampTicks = Event.TimestampTicks;
+    Record.ActorKey = FAssetTrackerHistoryRecord::MakeActorKey(Event.WorldPackage, Event.ActorName);
+    Record.ChatId = Event.ChatId;
+    Record.UserId = Event.UserId;
+    Record.Change = Event.Change;
+    Record.Uuid = Event.Uuid;
+
+    // 추적 대상이 아닌 계층 루트는 하위 기록만 남김
+    if (Event.Uuid.IsValid())
+    {
+        Event.ActorName.ToString(NameScratch);
+        Record.SetActorName(NameScratch);
+
+        OutRecords.Add(Record);
+    }
+
+    // 전송은 루트 이벤트 하나지만, UUID별 타임라인이 끊기지 않도록 하위 액터마다 기록
+    for (const FAssetTrackerDescendant& Descendant : Event.Descendants)
+    {
+        Record.ActorKey = FAssetTrackerHistoryRecord::MakeActorKey(Event.WorldPackage, Descendant.ActorName);
+        Record.ChatId = Descendant.ChatId;
+        Record.UserId = Descendant.UserId;
+        Record.Uuid = Descendant.Uuid;
+
+        Descendant.ActorName.ToString(NameScratch);
+        Record.SetActorName(NameScratch);
+
+        OutRecords.Add(Record);
+    }
+}
+
+void FAssetTrackerHistorySink::Consume(TArrayView<const FAssetTrackerEvent> Events)
+{
+    RecordScratch.Reset();
+    for (const FAssetTrackerEvent& Event : Events)
+    {
+        AssetTrackerEventToRecords(Event, NameScratch, RecordScratch);
+    }
+
+    // 배치 단위로 한 번 잠그고 한 번 플러시
+    History.Append(RecordScratch);
+}
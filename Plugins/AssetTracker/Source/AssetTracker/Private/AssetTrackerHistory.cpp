@@ -0,0 +1,450 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerHistory.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/StringBuilder.h"
+
+namespace AssetTrackerHistory
+{
+    constexpr uint32 Magic = 0x4C485441; // "ATHL"
+    constexpr uint32 Version = 2;   // v2: UUID를 16바이트 GUID로 저장
+    constexpr int32 RecordsPerSegment = 16 * 1024;
+    constexpr float CompactionInterval = 600.0f;
+
+    struct FSegmentHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 RecordSize;
+        uint32 Reserved;
+    };
+    static_assert(sizeof(FSegmentHeader) == 16, "");
+
+    static int32 RetentionDays = 7;
+    static FAutoConsoleVariableRef CVarRetentionDays(
+        TEXT("AssetTracker.History.RetentionDays"),
+        RetentionDays,
+        TEXT("Days of local tracking history to keep."));
+
+    static int32 MaxSizeMB = 64;
+    static FAutoConsoleVariableRef CVarMaxSizeMB(
+        TEXT("AssetTracker.History.MaxSizeMB"),
+        MaxSizeMB,
+        TEXT("Maximum total size of history segments kept on disk, in MB. Oldest segments are removed first."));
+
+    // 세션마다 새 세그먼트가 생기므로 개수가 아니라 실제 크기로 계산
+    FORCEINLINE int64 SegmentBytes(int32 NumRecords)
+    {
+        return (int64)sizeof(FSegmentHeader) + (int64)NumRecords * sizeof(FAssetTrackerHistoryRecord);
+    }
+}
+
+const TCHAR* LexToString(EAssetTrackerChange Change)
+{
+    switch (Change)
+    {
+    case EAssetTrackerChange::Location: return TEXT("RelativeLocation");
+    case EAssetTrackerChange::Rotation: return TEXT("RelativeRotation");
+    case EAssetTrackerChange::Scale:    return TEXT("RelativeScale3D");
+    case EAssetTrackerChange::Added:    return TEXT("Added");
+    case EAssetTrackerChange::Deleted:  return TEXT("Deleted");
+    case EAssetTrackerChange::Spawned:  return TEXT("Spawned");
+    case EAssetTrackerChange::Instances: return TEXT("Instances");
+    case EAssetTrackerChange::Hierarchy: return TEXT("Hierarchy");
+    default:                            return TEXT("Other");
+    }
+}
+
+void FAssetTrackerHistoryRecord::SetActorName(const FString& InName)
+{
+    FCStringAnsi::Strncpy(ActorName, TCHAR_TO_UTF8(*InName), UE_ARRAY_COUNT(ActorName));
+}
+
+uint64 FAssetTrackerHistoryRecord::MakeActorKey(FName WorldPackage, FName ActorName)
+{
+    TStringBuilder<256> Path;
+    Path << WorldPackage << TEXT(':') << ActorName;
+
+    FTCHARToUTF8 Utf8(Path.ToString(), Path.Len());
+    return CityHash64(Utf8.Get(), Utf8.Length());
+}
+
+FAssetTrackerHistory::~FAssetTrackerHistory()
+{
+    Close();
+}
+
+FString FAssetTrackerHistory::MakeSegmentFilename(int32 SegmentId) const
+{
+    return Directory / FString::Printf(TEXT("segment_%08d.athl"), SegmentId);
+}
+
+bool FAssetTrackerHistory::Open(const FString& InDirectory)
+{
+    Close();
+
+    IFileManager::Get().MakeDirectory(*InDirectory, true);
+
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(InDirectory / TEXT("segment_*.athl")), true, false);
+
+    TArray<int32> SegmentIds;
+    for (const FString& File : Files)
+    {
+        SegmentIds.Add(FCString::Atoi(*FPaths::GetBaseFilename(File).RightChop(8)));
+    }
+    SegmentIds.Sort();
+
+    FScopeLock ScopeLock(&Lock);
+    Directory = InDirectory;
+
+    // 기존 세그먼트는 모두 봉인 상태로 매핑하고 새 활성 세그먼트에서 이어 씀 (Id 사이 빈 곳은 허용)
+    for (int32 SegmentId : SegmentIds)
+    {
+        TUniquePtr<FSealedSegment> Segment = MakeUnique<FSealedSegment>();
+        const ESealResult Result = SealSegment(SegmentId, MakeSegmentFilename(SegmentId), *Segment);
+        if (Result == ESealResult::Sealed)
+        {
+            SealedSegments.Add(MoveTemp(Segment));
+        }
+        else if (Result == ESealResult::Incompatible)
+        {
+            // 이전 버전 형식은 다시 읽을 수 없으므로 바로 삭제
+            Segment.Reset();
+            IFileManager::Get().Delete(*MakeSegmentFilename(SegmentId));
+        }
+        else
+        {
+            // 잠금/주소 공간 부족 등 일시적 실패일 수 있으므로 파일은 남겨 두고 다음 실행에서 다시 시도
+            UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Skipping unreadable history segment %d"), SegmentId);
+            UnindexedSegmentFiles.Add(MakeSegmentFilename(SegmentId));
+        }
+    }
+
+    for (const TUniquePtr<FSealedSegment>& Segment : SealedSegments)
+    {
+        for (int32 i = 0; i < Segment->NumRecords; ++i)
+        {
+            IndexRecord(Segment->Records[i], FRecordRef{ Segment->Id, i });
+        }
+    }
+
+    const int32 NextId = SegmentIds.Num() > 0 ? SegmentIds.Last() + 1 : 0;
+    if (!BeginActiveSegment(NextId))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AssetTracker: Failed to open history segment in %s"), *Directory);
+        Directory.Empty();
+        return false;
+    }
+
+    CompactionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FAssetTrackerHistory::TickCompaction), AssetTrackerHistory::CompactionInterval);
+
+    UE_LOG(LogTemp, Log, TEXT("AssetTracker: History opened — %d segments, %d UUIDs, %d actors"),
+        SealedSegments.Num(), UuidIndex.Num(), ActorIndex.Num());
+    return true;
+}
+
+void FAssetTrackerHistory::Close()
+{
+    if (CompactionTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(CompactionTickerHandle);
+        CompactionTickerHandle.Reset();
+    }
+
+    // 진행 중인 백그라운드 정리 대기
+    while (bCompacting)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    if (ActiveWriter)
+    {
+        ActiveWriter.Reset();
+
+        // 빈 활성 세그먼트는 남기지 않음
+        if (ActiveRecords.Num() == 0)
+        {
+            IFileManager::Get().Delete(*MakeSegmentFilename(ActiveSegmentId));
+        }
+    }
+    ActiveRecords.Empty();
+    SealedSegments.Empty();
+    UnindexedSegmentFiles.Empty();
+    UuidIndex.Empty();
+    ActorIndex.Empty();
+    Directory.Empty();
+}
+
+FAssetTrackerHistory::ESealResult FAssetTrackerHistory::SealSegment(int32 SegmentId, const FString& Filename, FSealedSegment& OutSegment) const
+{
+    using namespace AssetTrackerHistory;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    const int64 FileSize = PlatformFile.FileSize(*Filename);
+    if (FileSize < (int64)sizeof(FSegmentHeader)) return ESealResult::Failed;
+
+    OutSegment.Id = SegmentId;
+    OutSegment.Filename = Filename;
+    OutSegment.MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+    if (!OutSegment.MappedFile) return ESealResult::Failed;
+
+    OutSegment.Region.Reset(OutSegment.MappedFile->MapRegion(0, FileSize));
+    if (!OutSegment.Region) return ESealResult::Failed;
+
+    const FSegmentHeader* Header = reinterpret_cast<const FSegmentHeader*>(OutSegment.Region->GetMappedPtr());
+    if (Header->Magic != Magic || Header->Version != Version || Header->RecordSize != sizeof(FAssetTrackerHistoryRecord))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Ignoring incompatible history segment %s"), *Filename);
+        return ESealResult::Incompatible;
+    }
+
+    // 비정상 종료로 잘린 마지막 레코드는 무시
+    OutSegment.Records = reinterpret_cast<const FAssetTrackerHistoryRecord*>(Header + 1);
+    OutSegment.NumRecords = (int32)((FileSize - sizeof(FSegmentHeader)) / sizeof(FAssetTrackerHistoryRecord));
+    return ESealResult::Sealed;
+}
+
+bool FAssetTrackerHistory::BeginActiveSegment(int32 SegmentId)
+{
+    using namespace AssetTrackerHistory;
+
+    ActiveSegmentId = SegmentId;
+    ActiveRecords.Reset();
+    ActiveRecords.Reserve(RecordsPerSegment);
+
+    ActiveWriter.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*MakeSegmentFilename(SegmentId)));
+    if (!ActiveWriter) return false;
+
+    const FSegmentHeader Header = { Magic, Version, (uint32)sizeof(FAssetTrackerHistoryRecord), 0 };
+    return ActiveWriter->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+}
+
+void FAssetTrackerHistory::RollActiveSegment()
+{
+    ActiveWriter.Reset();
+
+    TUniquePtr<FSealedSegment> Segment = MakeUnique<FSealedSegment>();
+    if (SealSegment(ActiveSegmentId, MakeSegmentFilename(ActiveSegmentId), *Segment) == ESealResult::Sealed)
+    {
+        SealedSegments.Add(MoveTemp(Segment));
+    }
+    else
+    {
+        // 매핑 실패한 세그먼트의 레퍼런스는 조회에서 건너뜀. 파일은 정리 대상으로 남김
+        UE_LOG(LogTemp, Error, TEXT("AssetTracker: Failed to map history segment %d"), ActiveSegmentId);
+        UnindexedSegmentFiles.Add(MakeSegmentFilename(ActiveSegmentId));
+    }
+
+    if (!BeginActiveSegment(ActiveSegmentId + 1))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AssetTracker: Failed to open history segment %d"), ActiveSegmentId);
+    }
+}
+
+void FAssetTrackerHistory::IndexRecord(const FAssetTrackerHistoryRecord& Record, FRecordRef Ref)
+{
+    UuidIndex.FindOrAdd(Record.Uuid).Add(Ref);
+    ActorIndex.FindOrAdd(Record.ActorKey).Add(Ref);
+}
+
+void FAssetTrackerHistory::Append(TArrayView<const FAssetTrackerHistoryRecord> Records)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    int32 Offset = 0;
+    while (Offset < Records.Num() && ActiveWriter)
+    {
+        // 활성 세그먼트에 들어가는 만큼 한 번에 기록
+        const int32 NumToWrite = FMath::Min(Records.Num() - Offset, AssetTrackerHistory::RecordsPerSegment - ActiveRecords.Num());
+        ActiveWriter->Write(reinterpret_cast<const uint8*>(Records.GetData() + Offset), NumToWrite * sizeof(FAssetTrackerHistoryRecord));
+
+        for (int32 i = Offset; i < Offset + NumToWrite; ++i)
+        {
+            const int32 Index = ActiveRecords.Add(Records[i]);
+            IndexRecord(Records[i], FRecordRef{ ActiveSegmentId, Index });
+        }
+        Offset += NumToWrite;
+
+        // 가득 찬 세그먼트는 닫으면서 플러시됨
+        if (ActiveRecords.Num() >= AssetTrackerHistory::RecordsPerSegment)
+        {
+            RollActiveSegment();
+        }
+    }
+
+    if (ActiveWriter && Offset > 0)
+    {
+        ActiveWriter->Flush();
+    }
+}
+
+const FAssetTrackerHistoryRecord* FAssetTrackerHistory::ResolveRef(FRecordRef Ref) const
+{
+    if (Ref.SegmentId == ActiveSegmentId)
+    {
+        return ActiveRecords.IsValidIndex(Ref.Index) ? &ActiveRecords[Ref.Index] : nullptr;
+    }
+
+    // Id 오름차순이지만 빈 곳이 있을 수 있음
+    const int32 SegmentIndex = Algo::BinarySearchBy(SealedSegments, Ref.SegmentId, [](const TUniquePtr<FSealedSegment>& Segment) { return Segment->Id; });
+    if (SegmentIndex == INDEX_NONE) return nullptr;
+
+    const FSealedSegment& Segment = *SealedSegments[SegmentIndex];
+    return Ref.Index < Segment.NumRecords ? &Segment.Records[Ref.Index] : nullptr;
+}
+
+void FAssetTrackerHistory::QueryRefs(const TArray<FRecordRef>* Refs, const FDateTime& From, const FDateTime& To, TArray<FAssetTrackerHistoryRecord>& OutRecords) const
+{
+    if (!Refs) return;
+
+    // 레퍼런스는 기록 순(= 시간 순)이므로 시작 위치는 이진 탐색
+    const int64 FromTicks = From.GetTicks();
+    const int64 ToTicks = To.GetTicks();
+    int32 Start = Algo::LowerBoundBy(*Refs, FromTicks, [this](FRecordRef Ref)
+        {
+            const FAssetTrackerHistoryRecord* Record = ResolveRef(Ref);
+            return Record ? Record->TimestampTicks : TNumericLimits<int64>::Min();
+        });
+
+    for (int32 i = Start; i < Refs->Num(); ++i)
+    {
+        const FAssetTrackerHistoryRecord* Record = ResolveRef((*Refs)[i]);
+        if (!Record) continue;
+        if (Record->TimestampTicks > ToTicks) break;
+        OutRecords.Add(*Record);
+    }
+}
+
+void FAssetTrackerHistory::QueryUuid(const FGuid& Uuid, const FDateTime& From, const FDateTime& To, TArray<FAssetTrackerHistoryRecord>& OutRecords) const
+{
+    FScopeLock ScopeLock(&Lock);
+    QueryRefs(UuidIndex.Find(Uuid), From, To, OutRecords);
+}
+
+void FAssetTrackerHistory::QueryActor(uint64 ActorKey, const FDateTime& From, const FDateTime& To, TArray<FAssetTrackerHistoryRecord>& OutRecords) const
+{
+    FScopeLock ScopeLock(&Lock);
+    QueryRefs(ActorIndex.Find(ActorKey), From, To, OutRecords);
+}
+
+bool FAssetTrackerHistory::TickCompaction(float DeltaTime)
+{
+    bool bExpected = false;
+    if (bCompacting.compare_exchange_strong(bExpected, true))
+    {
+        Async(EAsyncExecution::ThreadPool, [this]()
+            {
+                Compact();
+                bCompacting = false;
+            });
+    }
+    return true;
+}
+
+void FAssetTrackerHistory::Compact()
+{
+    using namespace AssetTrackerHistory;
+
+    const int64 CutoffTicks = (FDateTime::UtcNow() - FTimespan::FromDays(RetentionDays)).GetTicks();
+    const int64 MaxBytes = (int64)FMath::Max(MaxSizeMB, 1) * 1024 * 1024;
+    TArray<FString> FilesToDelete;
+
+    {
+        FScopeLock ScopeLock(&Lock);
+
+        // 활성 세그먼트는 지울 수 없지만 전체 크기에는 포함
+        int64 TotalBytes = SegmentBytes(ActiveRecords.Num());
+        for (const TUniquePtr<FSealedSegment>& Segment : SealedSegments)
+        {
+            TotalBytes += SegmentBytes(Segment->NumRecords);
+        }
+        TArray<int64> UnindexedBytes;
+        for (const FString& Filename : UnindexedSegmentFiles)
+        {
+            UnindexedBytes.Add(FMath::Max<int64>(IFileManager::Get().FileSize(*Filename), 0));
+            TotalBytes += UnindexedBytes.Last();
+        }
+
+        // 인덱스에 올리지 못한 세그먼트: 수정 시각이 보존 기간을 넘겼거나 크기 초과면 먼저 삭제
+        for (int32 i = 0; i < UnindexedSegmentFiles.Num(); )
+        {
+            const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*UnindexedSegmentFiles[i]);
+            const bool bExpired = TimeStamp == FDateTime::MinValue() || TimeStamp.GetTicks() < CutoffTicks;
+            if (TotalBytes > MaxBytes || bExpired)
+            {
+                TotalBytes -= UnindexedBytes[i];
+                FilesToDelete.Add(UnindexedSegmentFiles[i]);
+                UnindexedSegmentFiles.RemoveAt(i);
+                UnindexedBytes.RemoveAt(i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        // 앞(오래된)쪽부터: 크기 초과이거나 마지막 기록이 보존 기간을 넘긴 세그먼트
+        int32 NumToDrop = 0;
+        while (NumToDrop < SealedSegments.Num())
+        {
+            const FSealedSegment& Segment = *SealedSegments[NumToDrop];
+            const bool bExpired = Segment.NumRecords == 0 || Segment.Records[Segment.NumRecords - 1].TimestampTicks < CutoffTicks;
+            if (TotalBytes <= MaxBytes && !bExpired) break;
+            TotalBytes -= SegmentBytes(Segment.NumRecords);
+            ++NumToDrop;
+        }
+        if (NumToDrop == 0 && FilesToDelete.Num() == 0) return;
+
+        const int32 FirstKeptId = NumToDrop > 0 ? SealedSegments[NumToDrop - 1]->Id + 1 : 0;
+
+        for (int32 i = 0; i < NumToDrop; ++i)
+        {
+            FilesToDelete.Add(SealedSegments[i]->Filename);
+        }
+        // 매핑 해제 후 파일 삭제
+        SealedSegments.RemoveAt(0, NumToDrop);
+
+        // 인덱스는 시간 순이므로 삭제된 세그먼트 레퍼런스는 항상 앞부분
+        auto TrimIndex = [FirstKeptId](auto& Index)
+        {
+            for (auto It = Index.CreateIterator(); It; ++It)
+            {
+                TArray<FRecordRef>& Refs = It.Value();
+                const int32 NumStale = Algo::LowerBoundBy(Refs, FirstKeptId, [](FRecordRef Ref) { return Ref.SegmentId; });
+                if (NumStale == Refs.Num())
+                {
+                    It.RemoveCurrent();
+                }
+                else if (NumStale > 0)
+                {
+                    Refs.RemoveAt(0, NumStale);
+                }
+            }
+        };
+        if (NumToDrop > 0)
+        {
+            TrimIndex(UuidIndex);
+            TrimIndex(ActorIndex);
+        }
+    }
+
+    for (const FString& Filename : FilesToDelete)
+    {
+        IFileManager::Get().Delete(*Filename);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AssetTracker: History compaction removed %d segments"), FilesToDelete.Num());
+}
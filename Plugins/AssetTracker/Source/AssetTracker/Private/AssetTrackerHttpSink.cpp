@@ -0,0 +1,282 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerHttpSink.h"
+#include "AssetTrackerMetaStore.h"
+#include "AssetTrackerTransformStore.h"
+#include "Algo/StableSort.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+
+namespace AssetTrackerHttpSink
+{
+    static bool bEnabled = true;
+    static FAutoConsoleVariableRef CVarEnabled(
+        TEXT("AssetTracker.Sink.Http"),
+        bEnabled,
+        TEXT("Upload tracking events to the remote history server as JSON over HTTP."));
+
+    // DefaultGame.ini [AssetTracker] HttpEndpoint=... 로 재정의. 요청 URL은 <Endpoint>/<chatId>
+    const TCHAR* ConfigSection = TEXT("AssetTracker");
+    const TCHAR* DefaultEndpoint = TEXT("http://13.125.77.82:8080/api/v1/unreal-history");
+
+    // TJsonWriter/FJsonObject 없이 UTF-8로 바로 쓰는 최소 JSON 작성기
+    struct FUtf8JsonWriter
+    {
+        TArray<uint8>& Out;
+
+        void Raw(const ANSICHAR* Str)
+        {
+            Out.Append(reinterpret_cast<const uint8*>(Str), FCStringAnsi::Strlen(Str));
+        }
+
+        void Char(ANSICHAR C)
+        {
+            Out.Add((uint8)C);
+        }
+
+        void String(const ANSICHAR* Str, int32 Len)
+        {
+            Char('"');
+            for (int32 i = 0; i < Len; ++i)
+            {
+                const uint8 C = (uint8)Str[i];
+                if (C == '"' || C == '\\')
+                {
+                    Char('\\');
+                    Char((ANSICHAR)C);
+                }
+                else if (C < 0x20)
+                {
+                    ANSICHAR Escaped[8];
+                    FCStringAnsi::Snprintf(Escaped, UE_ARRAY_COUNT(Escaped), "\\u%04x", C);
+                    Raw(Escaped);
+                }
+                else
+                {
+                    Out.Add(C);
+                }
+            }
+            Char('"');
+        }
+
+        void Float(float Value)
+        {
+            ANSICHAR Buffer[32];
+            FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%.3f", Value);
+            Raw(Buffer);
+        }
+
+        void Vector(const FVector3f& Value)
+        {
+            Char('[');
+            Float(Value.X);
+            Char(',');
+            Float(Value.Y);
+            Char(',');
+            Float(Value.Z);
+            Char(']');
+        }
+
+        void Int(int64 Value)
+        {
+            ANSICHAR Buffer[24];
+            FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%lld", Value);
+            Raw(Buffer);
+        }
+
+        // FDateTime::ToIso8601()과 같은 형식
+        void Timestamp(int64 Ticks)
+        {
+            const FDateTime Time(Ticks);
+            ANSICHAR Buffer[32];
+            FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "\"%04d-%02d-%02dT%02d:%02d:%02d.%03dZ\"",
+                Time.GetYear(), Time.GetMonth(), Time.GetDay(),
+                Time.GetHour(), Time.GetMinute(), Time.GetSecond(), Time.GetMillisecond());
+            Raw(Buffer);
+        }
+    };
+}
+
+struct FAssetTrackerHttpSink::FResponseHandler : public TSharedFromThis<FResponseHandler, ESPMode::ThreadSafe>
+{
+    void OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+    {
+        if (!bWasSuccessful || !Response.IsValid())
+        {
+            UE_LOG(LogTemp, Error, TEXT("HTTP Failed"));
+            return;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("HTTP request completed. Status Code: %d, URL: %s"), Response->GetResponseCode(), *Request->GetURL());
+        UE_LOG(LogTemp, Verbose, TEXT("Response Content: %s"), *Response->GetContentAsString());
+    }
+};
+
+FAssetTrackerHttpSink::FAssetTrackerHttpSink()
+    : ResponseHandler(MakeShared<FResponseHandler, ESPMode::ThreadSafe>())
+    , HttpModule(&FHttpModule::Get())
+{
+    // 워커 스레드에서 설정을 읽지 않도록 생성 시(게임 스레드) 한 번만 읽음
+    if (!GConfig || !GConfig->GetString(AssetTrackerHttpSink::ConfigSection, TEXT("HttpEndpoint"), Endpoint, GGameIni) || Endpoint.IsEmpty())
+    {
+        Endpoint = AssetTrackerHttpSink::DefaultEndpoint;
+    }
+    Endpoint.RemoveFromEnd(TEXT("/"));
+}
+
+FAssetTrackerHttpSink::~FAssetTrackerHttpSink() = default;
+
+bool FAssetTrackerHttpSink::IsEnabled() const
+{
+    return AssetTrackerHttpSink::bEnabled;
+}
+
+void FAssetTrackerHttpSink::Consume(TArrayView<const FAssetTrackerEvent> Events)
+{
+    // URL/헤더가 chatId, userId 단위이므로 묶어서 한 번에 전송 (이벤트는 복사하지 않고 포인터만 정렬)
+    UploadScratch.Reset();
+    for (const FAssetTrackerEvent& Event : Events)
+    {
+        if (Event.bUpload)
+        {
+            UploadScratch.Add(&Event);
+        }
+    }
+    Algo::StableSortBy(UploadScratch, [](const FAssetTrackerEvent* Item) { return ((int64)Item->ChatId << 32) | (uint32)Item->UserId; });
+
+    int32 GroupStart = 0;
+    for (int32 i = 1; i <= UploadScratch.Num(); ++i)
+    {
+        if (i == UploadScratch.Num() || UploadScratch[i]->ChatId != UploadScratch[GroupStart]->ChatId || UploadScratch[i]->UserId != UploadScratch[GroupStart]->UserId)
+        {
+            Upload(TArrayView<const FAssetTrackerEvent* const>(UploadScratch.GetData() + GroupStart, i - GroupStart));
+            GroupStart = i;
+        }
+    }
+}
+
+void FAssetTrackerHttpSink::Upload(TArrayView<const FAssetTrackerEvent* const> Events)
+{
+    using namespace AssetTrackerHttpSink;
+
+    if (Events.Num() == 0) return;
+
+    PayloadBuffer.Reset();
+    FUtf8JsonWriter Writer{ PayloadBuffer };
+
+    ANSICHAR UuidText[37];
+
+    Writer.Char('[');
+    for (int32 i = 0; i < Events.Num(); ++i)
+    {
+        const FAssetTrackerEvent& Event = *Events[i];
+        if (i > 0) Writer.Char(',');
+
+        Event.ActorName.ToString(NameScratch);
+        FTCHARToUTF8 ActorName(*NameScratch);
+
+        Writer.Raw("{\"actorName\":");
+        Writer.String(ActorName.Get(), ActorName.Length());
+        Writer.Raw(",\"uuid\":");
+        if (Event.Uuid.IsValid())
+        {
+            Writer.String(UuidText, AssetTrackerFormatUuid(Event.Uuid, UuidText));
+        }
+        else
+        {
+            Writer.Raw("null");
+        }
+        Writer.Raw(",\"chatId\":");
+        Writer.Int(Event.ChatId);
+        Writer.Raw(",\"changeType\":");
+        FTCHARToUTF8 ChangeType(LexToString(Event.Change));
+        Writer.String(ChangeType.Get(), ChangeType.Length());
+        Writer.Raw(",\"timestamp\":");
+        Writer.Timestamp(Event.TimestampTicks);
+
+        if (Event.Instances.Num() > 0)
+        {
+            Event.ComponentName.ToString(NameScratch);
+            FTCHARToUTF8 ComponentName(*NameScratch);
+
+            Writer.Raw(",\"component\":");
+            Writer.String(ComponentName.Get(), ComponentName.Length());
+            Writer.Raw(",\"instances\":[");
+            for (int32 j = 0; j < Event.Instances.Num(); ++j)
+            {
+                const FAssetTrackerInstanceDelta& Delta = Event.Instances[j];
+                if (j > 0) Writer.Char(',');
+                Writer.Raw("{\"index\":");
+                Writer.Int(Delta.Index);
+                Writer.Raw(",\"type\":\"");
+                Writer.Raw(LexToAnsiString(Delta.Change));
+                Writer.Raw("\",\"delta\":");
+                Writer.Vector(Delta.LocationDelta);
+                Writer.Raw(",\"location\":");
+                Writer.Vector(Delta.Location);
+                Writer.Char('}');
+            }
+            Writer.Char(']');
+        }
+
+        if (Event.Change == EAssetTrackerChange::Hierarchy)
+        {
+            // 루트 트랜스폼 변경 항목과 이동량, 같이 움직인 추적 하위 액터
+            static const TPair<uint8, EAssetTrackerChange> Components[] = {
+                { EAssetTrackerTransformChange::Location, EAssetTrackerChange::Location },
+                { EAssetTrackerTransformChange::Rotation, EAssetTrackerChange::Rotation },
+                { EAssetTrackerTransformChange::Scale, EAssetTrackerChange::Scale },
+            };
+
+            Writer.Raw(",\"changes\":[");
+            bool bFirst = true;
+            for (const TPair<uint8, EAssetTrackerChange>& Entry : Components)
+            {
+                if (!(Event.TransformMask & Entry.Key)) continue;
+                if (!bFirst) Writer.Char(',');
+                bFirst = false;
+
+                FTCHARToUTF8 Component(LexToString(Entry.Value));
+                Writer.String(Component.Get(), Component.Length());
+            }
+            Writer.Raw("],\"delta\":");
+            Writer.Vector(Event.LocationDelta);
+            Writer.Raw(",\"descendants\":[");
+            for (int32 j = 0; j < Event.Descendants.Num(); ++j)
+            {
+                const FAssetTrackerDescendant& Descendant = Event.Descendants[j];
+                if (j > 0) Writer.Char(',');
+
+                Descendant.ActorName.ToString(NameScratch);
+                FTCHARToUTF8 DescendantName(*NameScratch);
+
+                Writer.Raw("{\"actorName\":");
+                Writer.String(DescendantName.Get(), DescendantName.Length());
+                Writer.Raw(",\"uuid\":");
+                Writer.String(UuidText, AssetTrackerFormatUuid(Descendant.Uuid, UuidText));
+                Writer.Char('}');
+            }
+            Writer.Char(']');
+        }
+        Writer.Char('}');
+    }
+    Writer.Char(']');
+
+    const int32 PayloadSize = PayloadBuffer.Num();
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = HttpModule->CreateRequest();
+    Request->SetURL(FString::Printf(TEXT("%s/%d"), *Endpoint, Events[0]->ChatId));
+    Request->SetVerb(TEXT("POST"));
+    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    Request->SetHeader(TEXT("userId"), FString::FromInt(Events[0]->UserId));
+
+    // 요청이 본문을 비동기로 보유하므로 정확한 크기로 한 번 복사 (직렬화 버퍼는 다음 배치에 그대로 재사용)
+    Request->SetContent(PayloadBuffer);
+
+    Request->OnProcessRequestComplete().BindThreadSafeSP(ResponseHandler.ToSharedRef(), &FResponseHandler::OnResponse);
+    Request->ProcessRequest();
+
+    UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] Sent %d events (%d bytes) for chatId %d"), Events.Num(), PayloadSize, Events[0]->ChatId);
+}
@@ -0,0 +1,295 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerInstanceTracker.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Math/VectorRegister.h"
+
+namespace AssetTrackerInstanceTracker
+{
+    constexpr float AxisTolerance = 1.0e-4f;
+    constexpr float LocationTolerance = 0.01f;
+
+    FORCEINLINE void Pack(const FMatrix44f& Matrix, float* Out)
+    {
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            Out[Row * 3 + 0] = Matrix.M[Row][0];
+            Out[Row * 3 + 1] = Matrix.M[Row][1];
+            Out[Row * 3 + 2] = Matrix.M[Row][2];
+        }
+    }
+}
+
+const ANSICHAR* LexToAnsiString(EAssetTrackerInstanceChange Change)
+{
+    switch (Change)
+    {
+    case EAssetTrackerInstanceChange::Added:   return "added";
+    case EAssetTrackerInstanceChange::Removed: return "removed";
+    default:                                   return "moved";
+    }
+}
+
+void FAssetTrackerInstanceTracker::Start()
+{
+    if (!IndexUpdatedHandle.IsValid())
+    {
+        IndexUpdatedHandle = FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.AddRaw(this, &FAssetTrackerInstanceTracker::OnInstanceIndexUpdated);
+    }
+}
+
+void FAssetTrackerInstanceTracker::Stop()
+{
+    if (IndexUpdatedHandle.IsValid())
+    {
+        FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.Remove(IndexUpdatedHandle);
+        IndexUpdatedHandle.Reset();
+    }
+    Empty();
+}
+
+void FAssetTrackerInstanceTracker::BeginEdit(UInstancedStaticMeshComponent* Component, FResolveUuid ResolveUuid)
+{
+    if (!Component) return;
+
+    FComponentState& State = States.FindOrAdd(Component);
+    ResolveComponent(Component, State, ResolveUuid);
+    if (State.Uuid.IsValid() && !State.bHasBaseline)
+    {
+        CaptureBaseline(Component, State);
+    }
+    MarkDirty(Component);
+}
+
+void FAssetTrackerInstanceTracker::ResolveComponent(UInstancedStaticMeshComponent* Component, FComponentState& State, FResolveUuid ResolveUuid)
+{
+    if (State.bResolved) return;
+
+    // 컴포넌트당 한 번만 해석 (인스턴스는 모두 같은 머티리얼)
+    State.bResolved = true;
+    State.Uuid = ResolveUuid(Component);
+    if (!State.Uuid.IsValid())
+    {
+        State.Snapshots.Empty();
+        State.AddedIndices.Empty();
+        State.Removed.Empty();
+        State.bHasBaseline = false;
+    }
+}
+
+void FAssetTrackerInstanceTracker::CaptureBaseline(UInstancedStaticMeshComponent* Component, FComponentState& State)
+{
+    const int32 NumInstances = Component->PerInstanceSMData.Num();
+    State.Snapshots.SetNumUninitialized(NumInstances);
+    for (int32 i = 0; i < NumInstances; ++i)
+    {
+        AssetTrackerInstanceTracker::Pack(Component->PerInstanceSMData[i].Transform, State.Snapshots[i].V);
+    }
+    State.bHasBaseline = true;
+}
+
+void FAssetTrackerInstanceTracker::MarkDirty(UInstancedStaticMeshComponent* Component)
+{
+    if (Component)
+    {
+        DirtyComponents.Add(Component);
+    }
+}
+
+void FAssetTrackerInstanceTracker::Forget(const UInstancedStaticMeshComponent* Component)
+{
+    const TWeakObjectPtr<UInstancedStaticMeshComponent> Key(const_cast<UInstancedStaticMeshComponent*>(Component));
+    States.Remove(Key);
+    DirtyComponents.Remove(Key);
+}
+
+void FAssetTrackerInstanceTracker::InvalidateUuid(const UInstancedStaticMeshComponent* Component)
+{
+    const TWeakObjectPtr<UInstancedStaticMeshComponent> Key(const_cast<UInstancedStaticMeshComponent*>(Component));
+    if (FComponentState* State = States.Find(Key))
+    {
+        State->bResolved = false;
+    }
+}
+
+void FAssetTrackerInstanceTracker::InvalidateUuids()
+{
+    // 스냅샷은 유지 (UUID가 그대로면 기준값도 그대로 유효)
+    for (TPair<TWeakObjectPtr<UInstancedStaticMeshComponent>, FComponentState>& Pair : States)
+    {
+        Pair.Value.bResolved = false;
+    }
+}
+
+void FAssetTrackerInstanceTracker::Empty()
+{
+    States.Empty();
+    DirtyComponents.Empty();
+}
+
+void FAssetTrackerInstanceTracker::OnInstanceIndexUpdated(UInstancedStaticMeshComponent* Component, TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> IndexUpdates)
+{
+    using EUpdateType = FInstancedStaticMeshDelegates::EInstanceIndexUpdateType;
+
+    FComponentState* State = States.Find(Component);
+
+    // 추적 대상이 아님이 확인된 컴포넌트는 무시
+    if (State && State->bResolved && !State->Uuid.IsValid()) return;
+
+    // 아직 해석 전이어도 추가분은 기록해 둠 (기준 스냅샷이 편집 후에 찍혀도 추가로 보고되도록)
+    if (!State)
+    {
+        State = &States.Add(Component);
+    }
+
+    // 인덱스 이동을 스냅샷에 반영해서 재배치된 인스턴스가 변경으로 보이지 않게 함
+    for (const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData& Update : IndexUpdates)
+    {
+        switch (Update.Type)
+        {
+        case EUpdateType::Added:
+            State->AddedIndices.Add(Update.Index);
+            break;
+        case EUpdateType::Removed:
+            // 뒤따르는 Relocated가 스냅샷을 덮어쓰기 전에 마지막 위치를 남김
+            if (State->bHasBaseline && State->Snapshots.IsValidIndex(Update.Index))
+            {
+                const float* V = State->Snapshots[Update.Index].V;
+                FAssetTrackerInstanceDelta& Removed = State->Removed.AddDefaulted_GetRef();
+                Removed.Index = Update.Index;
+                Removed.Change = EAssetTrackerInstanceChange::Removed;
+                Removed.Location = FVector3f(V[9], V[10], V[11]);
+            }
+            break;
+        case EUpdateType::Relocated:
+            if (State->bHasBaseline && State->Snapshots.IsValidIndex(Update.OldIndex) && State->Snapshots.IsValidIndex(Update.Index))
+            {
+                State->Snapshots[Update.Index] = State->Snapshots[Update.OldIndex];
+            }
+            break;
+        case EUpdateType::Cleared:
+            State->Snapshots.Reset();
+            State->AddedIndices.Reset();
+            State->Removed.Reset();
+            break;
+        case EUpdateType::Destroyed:
+            Forget(Component);
+            return;
+        default:
+            break;
+        }
+    }
+
+    MarkDirty(Component);
+}
+
+void FAssetTrackerInstanceTracker::Flush(FResolveUuid ResolveUuid, FOnInstancesChanged OnChanged)
+{
+    if (DirtyComponents.Num() == 0) return;
+
+    TSet<TWeakObjectPtr<UInstancedStaticMeshComponent>> Pending = MoveTemp(DirtyComponents);
+    DirtyComponents.Reset();
+
+    for (const TWeakObjectPtr<UInstancedStaticMeshComponent>& WeakComponent : Pending)
+    {
+        UInstancedStaticMeshComponent* Component = WeakComponent.Get();
+        if (!Component)
+        {
+            States.Remove(WeakComponent);
+            continue;
+        }
+
+        FComponentState& State = States.FindOrAdd(WeakComponent);
+        ResolveComponent(Component, State, ResolveUuid);
+        if (!State.Uuid.IsValid()) continue;
+
+        // 편집 전 훅을 거치지 않은 경로: 현재 상태를 기준으로 삼고 이번에 추가된 인스턴스만 보고
+        if (!State.bHasBaseline)
+        {
+            CaptureBaseline(Component, State);
+        }
+
+        DiffComponent(Component, State);
+        if (DeltaScratch.Num() > 0)
+        {
+            OnChanged(Component, State.Uuid, DeltaScratch);
+        }
+    }
+}
+
+void FAssetTrackerInstanceTracker::DiffComponent(UInstancedStaticMeshComponent* Component, FComponentState& State)
+{
+    using namespace AssetTrackerInstanceTracker;
+
+    DeltaScratch.Reset();
+    DeltaScratch.Append(State.Removed);
+    State.Removed.Reset();
+
+    const TArray<FInstancedStaticMeshInstanceData>& Instances = Component->PerInstanceSMData;
+    const int32 NumInstances = Instances.Num();
+    const int32 NumCompared = FMath::Min(NumInstances, State.Snapshots.Num());
+
+    // 레지스터 배치: [M00 M01 M02 M10] [M11 M12 M20 M21] [M22 T.x T.y T.z]
+    const VectorRegister4Float Tol0 = VectorSetFloat1(AxisTolerance);
+    const VectorRegister4Float Tol2 = MakeVectorRegisterFloat(AxisTolerance, LocationTolerance, LocationTolerance, LocationTolerance);
+
+    TBitArray<> AddedMask(false, NumInstances);
+    for (int32 Index : State.AddedIndices)
+    {
+        if (Index >= 0 && Index < NumInstances)
+        {
+            AddedMask[Index] = true;
+        }
+    }
+    State.AddedIndices.Reset();
+
+    FInstanceSnapshot Current;
+    for (int32 i = 0; i < NumCompared; ++i)
+    {
+        Pack(Instances[i].Transform, Current.V);
+        FInstanceSnapshot& Previous = State.Snapshots[i];
+
+        const VectorRegister4Float Diff0 = VectorAbs(VectorSubtract(VectorLoad(Current.V + 0), VectorLoad(Previous.V + 0)));
+        const VectorRegister4Float Diff1 = VectorAbs(VectorSubtract(VectorLoad(Current.V + 4), VectorLoad(Previous.V + 4)));
+        const VectorRegister4Float Diff2 = VectorAbs(VectorSubtract(VectorLoad(Current.V + 8), VectorLoad(Previous.V + 8)));
+
+        const VectorRegister4Float Exceeded = VectorBitwiseOr(
+            VectorBitwiseOr(VectorCompareGT(Diff0, Tol0), VectorCompareGT(Diff1, Tol0)),
+            VectorCompareGT(Diff2, Tol2));
+
+        if (VectorMaskBits(Exceeded) == 0 && !AddedMask[i]) continue;
+
+        FAssetTrackerInstanceDelta& Delta = DeltaScratch.AddDefaulted_GetRef();
+        Delta.Index = i;
+        Delta.Location = FVector3f(Current.V[9], Current.V[10], Current.V[11]);
+        if (AddedMask[i])
+        {
+            Delta.Change = EAssetTrackerInstanceChange::Added;
+        }
+        else
+        {
+            Delta.LocationDelta = FVector3f(Current.V[9] - Previous.V[9], Current.V[10] - Previous.V[10], Current.V[11] - Previous.V[11]);
+        }
+        Previous = Current;
+    }
+
+    // 새로 생긴 인스턴스 (페인팅 등): 이동량 없이 추가로 보고
+    if (NumInstances > State.Snapshots.Num())
+    {
+        const int32 OldNum = State.Snapshots.Num();
+        State.Snapshots.SetNumUninitialized(NumInstances);
+        for (int32 i = OldNum; i < NumInstances; ++i)
+        {
+            Pack(Instances[i].Transform, State.Snapshots[i].V);
+
+            FAssetTrackerInstanceDelta& Delta = DeltaScratch.AddDefaulted_GetRef();
+            Delta.Index = i;
+            Delta.Change = EAssetTrackerInstanceChange::Added;
+            Delta.Location = FVector3f(State.Snapshots[i].V[9], State.Snapshots[i].V[10], State.Snapshots[i].V[11]);
+        }
+    }
+    else if (NumInstances < State.Snapshots.Num())
+    {
+        State.Snapshots.SetNum(NumInstances);
+    }
+}
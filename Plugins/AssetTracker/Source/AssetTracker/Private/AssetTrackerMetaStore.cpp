@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerMetaStore.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+FGuid AssetTrackerParseUuid(const FString& Text)
+{
+    FGuid Uuid;
+    if (!FGuid::Parse(Text.TrimStartAndEnd(), Uuid))
+    {
+        Uuid.Invalidate();
+    }
+    return Uuid;
+}
+
+FString AssetTrackerUuidToString(const FGuid& Uuid)
+{
+    return Uuid.ToString(EGuidFormats::DigitsWithHyphensLower);
+}
+
+int32 AssetTrackerFormatUuid(const FGuid& Uuid, ANSICHAR (&Out)[37])
+{
+    return FCStringAnsi::Snprintf(Out, UE_ARRAY_COUNT(Out), "%08x-%04x-%04x-%04x-%04x%08x",
+        Uuid.A, Uuid.B >> 16, Uuid.B & 0xFFFF, Uuid.C >> 16, Uuid.C & 0xFFFF, Uuid.D);
+}
+
+void FAssetTrackerMetaStore::Reset(int32 ExpectedNum)
+{
+    Entries.Reset(ExpectedNum);
+}
+
+void FAssetTrackerMetaStore::Add(const FGuid& Uuid, int32 ChatId, int32 UserId)
+{
+    FAssetTrackerMeta& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Uuid = Uuid;
+    Entry.ChatId = ChatId;
+    Entry.UserId = UserId;
+}
+
+void FAssetTrackerMetaStore::Finalize()
+{
+    // 안정 정렬 후 같은 UUID 구간의 마지막 값만 남김
+    Algo::StableSortBy(Entries, &FAssetTrackerMeta::Uuid);
+
+    int32 Write = 0;
+    for (int32 Read = 0; Read < Entries.Num(); ++Read)
+    {
+        if (Write > 0 && Entries[Write - 1].Uuid == Entries[Read].Uuid)
+        {
+            Entries[Write - 1] = Entries[Read];
+            continue;
+        }
+        Entries[Write++] = Entries[Read];
+    }
+    Entries.SetNum(Write);
+    Entries.Shrink();
+}
+
+const FAssetTrackerMeta* FAssetTrackerMetaStore::Find(const FGuid& Uuid) const
+{
+    if (!Uuid.IsValid()) return nullptr;
+
+    const int32 Index = Algo::BinarySearchBy(Entries, Uuid, &FAssetTrackerMeta::Uuid);
+    return Index != INDEX_NONE ? &Entries[Index] : nullptr;
+}
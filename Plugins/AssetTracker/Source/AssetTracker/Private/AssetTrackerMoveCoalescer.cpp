@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerMoveCoalescer.h"
+#include "GameFramework/Actor.h"
+
+void FAssetTrackerMoveCoalescer::MarkDirty(AActor* Actor)
+{
+    if (Actor)
+    {
+        DirtyActors.Add(Actor);
+    }
+}
+
+void FAssetTrackerMoveCoalescer::Empty()
+{
+    DirtyActors.Empty();
+}
+
+void FAssetTrackerMoveCoalescer::Flush(FOnGroup OnGroup)
+{
+    if (DirtyActors.Num() == 0) return;
+
+    TArray<AActor*> Pending;
+    Pending.Reserve(DirtyActors.Num());
+    for (const TWeakObjectPtr<AActor>& WeakActor : DirtyActors)
+    {
+        if (AActor* Actor = WeakActor.Get())
+        {
+            Pending.Add(Actor);
+        }
+    }
+    DirtyActors.Reset();
+
+    GroupBySubtree(Pending, OnGroup);
+}
+
+void FAssetTrackerMoveCoalescer::GroupBySubtree(TArrayView<AActor* const> Actors, FOnGroup OnGroup)
+{
+    if (Actors.Num() == 0) return;
+
+    TSet<const AActor*> Members;
+    Members.Reserve(Actors.Num());
+    for (AActor* Actor : Actors)
+    {
+        Members.Add(Actor);
+    }
+
+    // 루트 → 하위 dirty 액터. 루트 순서는 입력 순서 유지
+    TArray<AActor*> Roots;
+    TMap<AActor*, TArray<AActor*>> Groups;
+
+    for (AActor* Actor : Actors)
+    {
+        // 부착 체인을 끝까지 올라가며 집합에 속한 가장 위 조상을 찾음
+        AActor* Root = Actor;
+        for (AActor* Parent = Actor->GetAttachParentActor(); Parent; Parent = Parent->GetAttachParentActor())
+        {
+            if (Members.Contains(Parent))
+            {
+                Root = Parent;
+            }
+        }
+
+        TArray<AActor*>* Descendants = Groups.Find(Root);
+        if (!Descendants)
+        {
+            Roots.Add(Root);
+            Descendants = &Groups.Add(Root);
+        }
+        if (Root != Actor)
+        {
+            Descendants->Add(Actor);
+        }
+    }
+
+    for (AActor* Root : Roots)
+    {
+        OnGroup(Root, Groups[Root]);
+    }
+}
@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerSharedMemorySink.h"
+#include "HAL/IConsoleManager.h"
+
+namespace AssetTrackerSharedMemorySink
+{
+    static bool bEnabled = false;
+    static FAutoConsoleVariableRef CVarEnabled(
+        TEXT("AssetTracker.Sink.SharedMemory"),
+        bEnabled,
+        TEXT("Publish tracking events as fixed-size binary records to a shared-memory ring for a local sidecar process."));
+
+    static FString RegionName = TEXT("AssetTrackerEvents");
+    static FAutoConsoleVariableRef CVarRegionName(
+        TEXT("AssetTracker.Sink.SharedMemory.Name"),
+        RegionName,
+        TEXT("Name of the shared-memory region. Applied the next time the ring is mapped (toggle AssetTracker.Sink.SharedMemory off and on)."));
+
+    static int32 Capacity = 8192;
+    static FAutoConsoleVariableRef CVarCapacity(
+        TEXT("AssetTracker.Sink.SharedMemory.Capacity"),
+        Capacity,
+        TEXT("Number of records in the ring (rounded up to a power of two). Applied the next time the ring is mapped (toggle AssetTracker.Sink.SharedMemory off and on)."));
+}
+
+FAssetTrackerSharedMemorySink::~FAssetTrackerSharedMemorySink()
+{
+    Unmap();
+}
+
+bool FAssetTrackerSharedMemorySink::IsEnabled() const
+{
+    if (!AssetTrackerSharedMemorySink::bEnabled)
+    {
+        // 꺼짐: 다시 켜면 매핑을 재시도. 매핑이 남아 있으면 한 번 더 Consume을 받아 해제
+        bMapFailed = false;
+        return Region != nullptr;
+    }
+    return !bMapFailed;
+}
+
+bool FAssetTrackerSharedMemorySink::Map()
+{
+    using namespace AssetTrackerSharedMemorySink;
+
+    const uint32 NumRecords = FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(Capacity, 64));
+    const SIZE_T Size = sizeof(FAssetTrackerRingHeader) + (SIZE_T)NumRecords * sizeof(FAssetTrackerHistoryRecord);
+
+    Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, true,
+        FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, Size);
+    if (!Region)
+    {
+        UE_LOG(LogTemp, Error, TEXT("AssetTracker: Failed to map shared-memory ring '%s' (%llu bytes)"), *RegionName, (uint64)Size);
+        bMapFailed = true;
+        return false;
+    }
+
+    // 생산자가 새로 초기화 (이전 실행의 미소비 레코드는 버림). Magic은 마지막에 기록
+    Header = new (Region->GetAddress()) FAssetTrackerRingHeader();
+    Header->Version = FAssetTrackerRingHeader::CurrentVersion;
+    Header->RecordSize = sizeof(FAssetTrackerHistoryRecord);
+    Header->Capacity = NumRecords;
+    Header->Epoch = (uint64)FDateTime::UtcNow().GetTicks();
+    std::atomic_thread_fence(std::memory_order_release);
+    Header->Magic = FAssetTrackerRingHeader::MagicValue;
+
+    Records = reinterpret_cast<FAssetTrackerHistoryRecord*>(Header + 1);
+    CapacityMask = NumRecords - 1;
+    bConsumerOutOfSync = false;
+
+    UE_LOG(LogTemp, Log, TEXT("AssetTracker: Shared-memory ring '%s' mapped (%u records, epoch %llu)"), *RegionName, NumRecords, Header->Epoch);
+    return true;
+}
+
+void FAssetTrackerSharedMemorySink::Unmap()
+{
+    if (Region)
+    {
+        UE_LOG(LogTemp, Log, TEXT("AssetTracker: Shared-memory ring unmapped"));
+        FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+        Region = nullptr;
+    }
+    Header = nullptr;
+    Records = nullptr;
+    CapacityMask = 0;
+}
+
+void FAssetTrackerSharedMemorySink::Consume(TArrayView<const FAssetTrackerEvent> Events)
+{
+    if (!AssetTrackerSharedMemorySink::bEnabled)
+    {
+        // CVar가 꺼진 뒤의 배치는 버리고 링 해제
+        Unmap();
+        return;
+    }
+    if (!Header && !Map()) return;
+
+    RecordScratch.Reset();
+    for (const FAssetTrackerEvent& Event : Events)
+    {
+        AssetTrackerEventToRecords(Event, NameScratch, RecordScratch);
+    }
+    if (RecordScratch.Num() == 0) return;
+
+    // 단일 생산자: WriteIndex는 이 스레드만 씀
+    const uint64 WriteIndex = Header->WriteIndex.load(std::memory_order_relaxed);
+    const uint64 ReadIndex = Header->ReadIndex.load(std::memory_order_acquire);
+
+    // 에디터 재시작 뒤에도 남은 사이드카가 이전 링의 ReadIndex를 써넣으면 범위를 벗어남.
+    // 소비자가 Epoch를 보고 다시 맞출 때까지 가득 찬 것으로 취급 (언더플로로 덮어쓰지 않도록)
+    const uint64 Used = WriteIndex - ReadIndex;
+    const bool bOutOfSync = ReadIndex > WriteIndex || Used > (uint64)Header->Capacity;
+    if (bOutOfSync != bConsumerOutOfSync)
+    {
+        bConsumerOutOfSync = bOutOfSync;
+        if (bOutOfSync)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("AssetTracker: Shared-memory ring consumer out of sync (read %llu, write %llu), dropping records until it resyncs"), ReadIndex, WriteIndex);
+        }
+    }
+    const uint64 Free = bOutOfSync ? 0 : (uint64)Header->Capacity - Used;
+
+    const int32 NumToWrite = (int32)FMath::Min<uint64>(Free, (uint64)RecordScratch.Num());
+    for (int32 i = 0; i < NumToWrite; ++i)
+    {
+        FMemory::Memcpy(&Records[(WriteIndex + i) & CapacityMask], &RecordScratch[i], sizeof(FAssetTrackerHistoryRecord));
+    }
+
+    // 배치당 한 번 게시
+    Header->WriteIndex.store(WriteIndex + NumToWrite, std::memory_order_release);
+
+    if (NumToWrite < RecordScratch.Num())
+    {
+        Header->DroppedCount.fetch_add(RecordScratch.Num() - NumToWrite, std::memory_order_relaxed);
+        UE_LOG(LogTemp, Verbose, TEXT("[TrackLog] Shared-memory ring full, dropped %d records"), RecordScratch.Num() - NumToWrite);
+    }
+}
@@ -0,0 +1,307 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerTransformStore.h"
+#include "GameFramework/Actor.h"
+#include "Math/VectorRegister.h"
+
+namespace AssetTrackerTransformStore
+{
+    // 위치/스케일 허용 오차를 각도(도)로 해석해 쿼터니언 내적 하한으로 변환
+    // |dot(q1, q2)| = cos(theta / 2)
+    FORCEINLINE double RotationDotThreshold(double ToleranceDegrees)
+    {
+        return FMath::Cos(FMath::DegreesToRadians(ToleranceDegrees) * 0.5);
+    }
+}
+
+void FAssetTrackerTransformStore::FBlock::Write(int32 Lane, const FTransform& Transform)
+{
+    const FVector Location = Transform.GetLocation();
+    const FQuat Rotation = Transform.GetRotation();
+    const FVector Scale = Transform.GetScale3D();
+
+    LocX[Lane] = Location.X;
+    LocY[Lane] = Location.Y;
+    LocZ[Lane] = Location.Z;
+    RotX[Lane] = Rotation.X;
+    RotY[Lane] = Rotation.Y;
+    RotZ[Lane] = Rotation.Z;
+    RotW[Lane] = Rotation.W;
+    ScaleX[Lane] = Scale.X;
+    ScaleY[Lane] = Scale.Y;
+    ScaleZ[Lane] = Scale.Z;
+}
+
+FTransform FAssetTrackerTransformStore::FBlock::Read(int32 Lane) const
+{
+    return FTransform(
+        FQuat(RotX[Lane], RotY[Lane], RotZ[Lane], RotW[Lane]),
+        FVector(LocX[Lane], LocY[Lane], LocZ[Lane]),
+        FVector(ScaleX[Lane], ScaleY[Lane], ScaleZ[Lane]));
+}
+
+void FAssetTrackerTransformStore::CompareBlock(const FBlock& Current, const FBlock& Previous, double Tolerance, uint8 OutMasks[LanesPerBlock])
+{
+    const VectorRegister4Double Tol = VectorSetFloat1(Tolerance);
+    const VectorRegister4Double DotThreshold = VectorSetFloat1(AssetTrackerTransformStore::RotationDotThreshold(Tolerance));
+
+    auto Exceeds = [&Tol](const double* A, const double* B)
+    {
+        return VectorCompareGT(VectorAbs(VectorSubtract(VectorLoad(A), VectorLoad(B))), Tol);
+    };
+
+    // 위치
+    const int32 LocationMask = VectorMaskBits(VectorBitwiseOr(
+        VectorBitwiseOr(Exceeds(Current.LocX, Previous.LocX), Exceeds(Current.LocY, Previous.LocY)),
+        Exceeds(Current.LocZ, Previous.LocZ)));
+
+    // 스케일
+    const int32 ScaleMask = VectorMaskBits(VectorBitwiseOr(
+        VectorBitwiseOr(Exceeds(Current.ScaleX, Previous.ScaleX), Exceeds(Current.ScaleY, Previous.ScaleY)),
+        Exceeds(Current.ScaleZ, Previous.ScaleZ)));
+
+    // 회전: q와 -q는 같은 회전이므로 내적의 절댓값으로 비교
+    VectorRegister4Double Dot = VectorMultiply(VectorLoad(Current.RotX), VectorLoad(Previous.RotX));
+    Dot = VectorMultiplyAdd(VectorLoad(Current.RotY), VectorLoad(Previous.RotY), Dot);
+    Dot = VectorMultiplyAdd(VectorLoad(Current.RotZ), VectorLoad(Previous.RotZ), Dot);
+    Dot = VectorMultiplyAdd(VectorLoad(Current.RotW), VectorLoad(Previous.RotW), Dot);
+    const int32 RotationMask = VectorMaskBits(VectorCompareGT(DotThreshold, VectorAbs(Dot)));
+
+    for (int32 Lane = 0; Lane < LanesPerBlock; ++Lane)
+    {
+        const int32 Bit = 1 << Lane;
+        OutMasks[Lane] =
+            ((LocationMask & Bit) ? EAssetTrackerTransformChange::Location : 0) |
+            ((RotationMask & Bit) ? EAssetTrackerTransformChange::Rotation : 0) |
+            ((ScaleMask & Bit) ? EAssetTrackerTransformChange::Scale : 0);
+    }
+}
+
+uint8 FAssetTrackerTransformStore::Compare(const FTransform& Current, const FTransform& Previous, double Tolerance)
+{
+    uint8 Mask = EAssetTrackerTransformChange::None;
+    if (!Current.GetLocation().Equals(Previous.GetLocation(), Tolerance))
+    {
+        Mask |= EAssetTrackerTransformChange::Location;
+    }
+    if (FMath::Abs(Current.GetRotation() | Previous.GetRotation()) < AssetTrackerTransformStore::RotationDotThreshold(Tolerance))
+    {
+        Mask |= EAssetTrackerTransformChange::Rotation;
+    }
+    if (!Current.GetScale3D().Equals(Previous.GetScale3D(), Tolerance))
+    {
+        Mask |= EAssetTrackerTransformChange::Scale;
+    }
+    return Mask;
+}
+
+int32 FAssetTrackerTransformStore::AllocateSlot()
+{
+    if (FreeSlots.Num() > 0)
+    {
+        return FreeSlots.Pop(EAllowShrinking::No);
+    }
+
+    const int32 Slot = SlotActors.Num();
+    SlotActors.AddDefaulted();
+    SlotUuids.AddDefaulted();
+    SlotKeys.Add(nullptr);
+    StaleSlots.Add(false);
+    ResolvedUuids.Add(false);
+    if (Slot % LanesPerBlock == 0)
+    {
+        Blocks.AddZeroed();
+    }
+    return Slot;
+}
+
+void FAssetTrackerTransformStore::ReleaseStaleSlot(int32 Slot)
+{
+    const int32* Mapped = SlotLookup.Find(SlotKeys[Slot]);
+    if (Mapped && *Mapped == Slot)
+    {
+        SlotLookup.Remove(SlotKeys[Slot]);
+    }
+    SlotKeys[Slot] = nullptr;
+    SlotActors[Slot].Reset();
+    SlotUuids[Slot].Invalidate();
+    StaleSlots[Slot] = false;
+    ResolvedUuids[Slot] = false;
+    FreeSlots.Add(Slot);
+}
+
+bool FAssetTrackerTransformStore::Get(const AActor* Actor, FTransform& OutTransform) const
+{
+    const int32* Slot = SlotLookup.Find(Actor);
+    if (!Slot || StaleSlots[*Slot]) return false;
+
+    OutTransform = Blocks[*Slot / LanesPerBlock].Read(*Slot % LanesPerBlock);
+    return true;
+}
+
+void FAssetTrackerTransformStore::Set(AActor* Actor, const FTransform& Transform, const FGuid& Uuid)
+{
+    if (!Actor) return;
+
+    int32 Slot;
+    if (const int32* Existing = SlotLookup.Find(Actor))
+    {
+        Slot = *Existing;
+    }
+    else
+    {
+        Slot = AllocateSlot();
+        SlotLookup.Add(Actor, Slot);
+        SlotKeys[Slot] = Actor;
+    }
+
+    // 같은 주소에 새 액터가 생긴 경우도 있으므로 항상 갱신
+    SlotActors[Slot] = Actor;
+    SlotUuids[Slot] = Uuid;
+    StaleSlots[Slot] = false;
+    ResolvedUuids[Slot] = true;
+    Blocks[Slot / LanesPerBlock].Write(Slot % LanesPerBlock, Transform);
+}
+
+void FAssetTrackerTransformStore::Remove(const AActor* Actor)
+{
+    int32 Slot;
+    if (SlotLookup.RemoveAndCopyValue(Actor, Slot))
+    {
+        SlotKeys[Slot] = nullptr;
+        SlotActors[Slot].Reset();
+        SlotUuids[Slot].Invalidate();
+        StaleSlots[Slot] = false;
+        ResolvedUuids[Slot] = false;
+        FreeSlots.Add(Slot);
+    }
+}
+
+void FAssetTrackerTransformStore::MarkStale(const AActor* Actor)
+{
+    if (const int32* Slot = SlotLookup.Find(Actor))
+    {
+        StaleSlots[*Slot] = true;
+    }
+}
+
+bool FAssetTrackerTransformStore::FindUuid(const AActor* Actor, FGuid& OutUuid) const
+{
+    const int32* Slot = SlotLookup.Find(Actor);
+    // 같은 주소에 새로 생긴 액터는 이전 UUID를 쓰지 않음
+    if (!Slot || !ResolvedUuids[*Slot] || SlotActors[*Slot].Get() != Actor) return false;
+
+    OutUuid = SlotUuids[*Slot];
+    return true;
+}
+
+bool FAssetTrackerTransformStore::SetUuid(const AActor* Actor, const FGuid& Uuid)
+{
+    const int32* Slot = SlotLookup.Find(Actor);
+    if (!Slot || SlotActors[*Slot].Get() != Actor) return false;
+
+    SlotUuids[*Slot] = Uuid;
+    ResolvedUuids[*Slot] = true;
+    return true;
+}
+
+void FAssetTrackerTransformStore::InvalidateUuid(const AActor* Actor)
+{
+    if (const int32* Slot = SlotLookup.Find(Actor))
+    {
+        ResolvedUuids[*Slot] = false;
+    }
+}
+
+void FAssetTrackerTransformStore::InvalidateUuids()
+{
+    ResolvedUuids.SetRange(0, ResolvedUuids.Num(), false);
+}
+
+void FAssetTrackerTransformStore::Empty()
+{
+    Blocks.Empty();
+    SlotActors.Empty();
+    SlotUuids.Empty();
+    SlotKeys.Empty();
+    StaleSlots.Empty();
+    ResolvedUuids.Empty();
+    FreeSlots.Empty();
+    SlotLookup.Empty();
+    Cursor = 0;
+}
+
+bool FAssetTrackerTransformStore::ReconcileSlice(int32 MaxSlots, double Tolerance,
+    TFunctionRef<void(AActor* Actor, const FGuid& Uuid, uint8 ChangeMask, const FTransform& Current)> OnChanged)
+{
+    if (Blocks.Num() == 0) return true;
+
+    // 블록 단위로 진행
+    const int32 NumBlocks = FMath::Max(1, MaxSlots / LanesPerBlock);
+    int32 BlockIndex = Cursor / LanesPerBlock;
+
+    FBlock Current;
+    uint8 Masks[LanesPerBlock];
+
+    for (int32 Processed = 0; Processed < NumBlocks && BlockIndex < Blocks.Num(); ++Processed, ++BlockIndex)
+    {
+        FBlock& Previous = Blocks[BlockIndex];
+        AActor* LaneActors[LanesPerBlock] = {};
+
+        // 현재 트랜스폼 수집. 빈/무효 슬롯은 이전 값을 복사해서 비교에서 제외
+        for (int32 Lane = 0; Lane < LanesPerBlock; ++Lane)
+        {
+            const int32 Slot = BlockIndex * LanesPerBlock + Lane;
+            AActor* Actor = SlotActors.IsValidIndex(Slot) ? SlotActors[Slot].Get() : nullptr;
+            if (Actor)
+            {
+                LaneActors[Lane] = Actor;
+                Current.Write(Lane, Actor->GetActorTransform());
+            }
+            else
+            {
+                Current.Write(Lane, Previous.Read(Lane));
+                if (SlotActors.IsValidIndex(Slot) && !SlotActors[Slot].IsExplicitlyNull() && SlotActors[Slot].IsStale())
+                {
+                    // 삭제 델리게이트 없이 사라진 액터 정리
+                    ReleaseStaleSlot(Slot);
+                }
+            }
+        }
+
+        CompareBlock(Current, Previous, Tolerance, Masks);
+
+        for (int32 Lane = 0; Lane < LanesPerBlock; ++Lane)
+        {
+            const int32 Slot = BlockIndex * LanesPerBlock + Lane;
+            if (!LaneActors[Lane]) continue;
+
+            // 부모 이동으로 무효화된 스냅샷은 보고 없이 새 기준값으로
+            if (StaleSlots[Slot])
+            {
+                Previous.Write(Lane, Current.Read(Lane));
+                StaleSlots[Slot] = false;
+                continue;
+            }
+            if (Masks[Lane] == EAssetTrackerTransformChange::None) continue;
+
+            const FTransform CurrentTransform = Current.Read(Lane);
+            Previous.Write(Lane, CurrentTransform);
+
+            // UUID 없는 슬롯은 계층 이동 기준점(추적 하위를 가진 부모)이므로 보고하지 않음
+            if (SlotUuids[Slot].IsValid())
+            {
+                OnChanged(LaneActors[Lane], SlotUuids[Slot], Masks[Lane], CurrentTransform);
+            }
+        }
+    }
+
+    if (BlockIndex >= Blocks.Num())
+    {
+        Cursor = 0;
+        return true;
+    }
+
+    Cursor = BlockIndex * LanesPerBlock;
+    return false;
+}
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerUuidTable.h"
+#include "Algo/BinarySearch.h"
+
+const TCHAR* UAssetTrackerUuidTable::PackageName = TEXT("/AssetTracker/AssetTrackerUuidTable");
+const TCHAR* UAssetTrackerUuidTable::ObjectPath = TEXT("/AssetTracker/AssetTrackerUuidTable.AssetTrackerUuidTable");
+
+int32 UAssetTrackerUuidTable::FindEntryIndex(const UObject* Asset) const
+{
+    // 머티리얼은 최상위 에셋이므로 패키지/에셋 FName 쌍만으로 경로가 정해짐
+    if (!Asset || !Asset->GetOuter() || Asset->GetOuter()->GetOuter()) return INDEX_NONE;
+
+    const int32 PathIndex = Algo::BinarySearch(Paths, FTopLevelAssetPath(Asset->GetOuter()->GetFName(), Asset->GetFName()), &PathLess);
+    return PathIndex != INDEX_NONE ? EntryIndices[PathIndex] : INDEX_NONE;
+}
+
+const FAssetTrackerBakedEntry* UAssetTrackerUuidTable::Find(const UObject* Asset) const
+{
+    const int32 EntryIndex = FindEntryIndex(Asset);
+    return EntryIndex != INDEX_NONE ? &Entries[EntryIndex] : nullptr;
+}
+
+#if WITH_EDITOR
+void UAssetTrackerUuidTable::Reset()
+{
+    Paths.Reset();
+    EntryIndices.Reset();
+    Entries.Reset();
+    PendingEntryLookup.Reset();
+}
+
+void UAssetTrackerUuidTable::Add(const FSoftObjectPath& Path, const FAssetTrackerBakedEntry& Entry)
+{
+    int32 EntryIndex;
+    if (const int32* Existing = PendingEntryLookup.Find(Entry.Uuid))
+    {
+        EntryIndex = *Existing;
+    }
+    else
+    {
+        EntryIndex = Entries.Add(Entry);
+        PendingEntryLookup.Add(Entry.Uuid, EntryIndex);
+    }
+
+    Paths.Add(Path.GetAssetPath());
+    EntryIndices.Add(EntryIndex);
+}
+
+void UAssetTrackerUuidTable::Finalize()
+{
+    TArray<int32> Order;
+    Order.Reserve(Paths.Num());
+    for (int32 i = 0; i < Paths.Num(); ++i)
+    {
+        Order.Add(i);
+    }
+    // FindEntryIndex와 같은 순서로 정렬
+    Order.StableSort([this](int32 A, int32 B) { return PathLess(Paths[A], Paths[B]); });
+
+    TArray<FTopLevelAssetPath> SortedPaths;
+    TArray<int32> SortedIndices;
+    SortedPaths.Reserve(Paths.Num());
+    SortedIndices.Reserve(Paths.Num());
+
+    for (int32 i : Order)
+    {
+        // 같은 에셋이 두 번 들어온 경우 처음 값만 유지
+        if (SortedPaths.Num() > 0 && SortedPaths.Last() == Paths[i])
+        {
+            continue;
+        }
+        SortedPaths.Add(Paths[i]);
+        SortedIndices.Add(EntryIndices[i]);
+    }
+
+    Paths = MoveTemp(SortedPaths);
+    EntryIndices = MoveTemp(SortedIndices);
+    PendingEntryLookup.Reset();
+}
+#endif
@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetTrackerWorldIndex.h"
+
+#if WITH_EDITOR
+
+#include "AssetTrackerMetaStore.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "GameFramework/Actor.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+
+namespace AssetTrackerWorldIndex
+{
+    // 액터 → 메시 → 머티리얼 인스턴스 → 부모 머티리얼 → 텍스처
+    constexpr int32 MaxDependencyDepth = 5;
+}
+
+void FAssetTrackerWorldIndex::Reset()
+{
+    World.Reset();
+    Entries.Empty();
+    TexturePackageUuids.Empty();
+    PackageUuidCache.Empty();
+    ResolvingPackages.Empty();
+    LoadedCount = 0;
+}
+
+void FAssetTrackerWorldIndex::Build(UWorld* InWorld, const FAssetTrackerMetaStore& MetaStore)
+{
+    Reset();
+
+    UWorldPartition* WorldPartition = InWorld ? InWorld->GetWorldPartition() : nullptr;
+    if (!WorldPartition || MetaStore.Num() == 0) return;
+
+    World = InWorld;
+
+    auto& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    // 태그 대상 텍스처 패키지 (TagExistingAssets와 같은 기준: 에셋 이름 == UUID)
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UTexture2D::StaticClass()->GetClassPathName());
+    Filter.PackagePaths.Add("/Game");
+    Filter.bRecursivePaths = true;
+
+    TArray<FAssetData> AssetList;
+    AssetRegistry.GetAssets(Filter, AssetList);
+
+    for (const FAssetData& Data : AssetList)
+    {
+        const FGuid Uuid = AssetTrackerParseUuid(Data.AssetName.ToString());
+        if (MetaStore.Contains(Uuid))
+        {
+            TexturePackageUuids.Add(Data.PackageName, Uuid);
+        }
+    }
+
+    // 디스크립터만 순회 - 셀은 로드하지 않음
+    FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, AActor::StaticClass(),
+        [this](const FWorldPartitionActorDescInstance* DescInstance)
+        {
+            const FName ActorPackage = DescInstance->GetActorPackage();
+            bool bTruncated = false;
+            const FGuid Uuid = ResolvePackageUuid(ActorPackage, 0, bTruncated);
+            if (Uuid.IsValid())
+            {
+                FActorEntry& Entry = Entries.Add(DescInstance->GetGuid());
+                Entry.ActorPackage = ActorPackage;
+                Entry.Uuid = Uuid;
+                Entry.bLoaded = DescInstance->IsLoaded();
+                LoadedCount += Entry.bLoaded ? 1 : 0;
+            }
+            return true;
+        });
+
+    // 액터 해석이 끝나면 중간 패키지 메모는 필요 없음
+    PackageUuidCache.Empty();
+
+    UE_LOG(LogTemp, Warning, TEXT("AssetTracker: World index built for %s — %d tracked actors (%d loaded), %d tagged textures"),
+        *InWorld->GetName(), Entries.Num(), LoadedCount, TexturePackageUuids.Num());
+}
+
+FGuid FAssetTrackerWorldIndex::ResolvePackageUuid(FName PackageName, int32 Depth, bool& bOutTruncated)
+{
+    if (const FGuid* Tagged = TexturePackageUuids.Find(PackageName))
+    {
+        return *Tagged;
+    }
+    if (const FGuid* Cached = PackageUuidCache.Find(PackageName))
+    {
+        return *Cached;
+    }
+
+    // 깊이 제한이나 순환으로 끊긴 결과는 호출 경로에 따라 달라지므로 메모하지 않음
+    if (Depth >= AssetTrackerWorldIndex::MaxDependencyDepth || ResolvingPackages.Contains(PackageName))
+    {
+        bOutTruncated = true;
+        return FGuid();
+    }
+
+    ResolvingPackages.Add(PackageName);
+
+    auto& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    TArray<FName> Dependencies;
+    AssetRegistry.GetDependencies(PackageName, Dependencies,
+        UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+    FGuid Result;
+    bool bTruncated = false;
+    for (FName Dependency : Dependencies)
+    {
+        // 스크립트 패키지는 에셋이 아님
+        if (FPackageName::IsScriptPackage(Dependency.ToString())) continue;
+
+        Result = ResolvePackageUuid(Dependency, Depth + 1, bTruncated);
+        if (Result.IsValid()) break;
+    }
+
+    ResolvingPackages.Remove(PackageName);
+
+    if (bTruncated)
+    {
+        bOutTruncated = true;
+    }
+    else
+    {
+        PackageUuidCache.Add(PackageName, Result);
+    }
+    return Result;
+}
+
+void FAssetTrackerWorldIndex::OnActorLoaded(const AActor& Actor)
+{
+    if (FActorEntry* Entry = Entries.Find(Actor.GetActorGuid()))
+    {
+        if (!Entry->bLoaded)
+        {
+            Entry->bLoaded = true;
+            ++LoadedCount;
+        }
+    }
+}
+
+void FAssetTrackerWorldIndex::OnActorUnloaded(const AActor& Actor)
+{
+    if (FActorEntry* Entry = Entries.Find(Actor.GetActorGuid()))
+    {
+        if (Entry->bLoaded)
+        {
+            Entry->bLoaded = false;
+            --LoadedCount;
+        }
+    }
+}
+
+void FAssetTrackerWorldIndex::SetActorUuid(const AActor& Actor, const FGuid& Uuid)
+{
+    if (!World.IsValid()) return;
+
+    FActorEntry& Entry = Entries.FindOrAdd(Actor.GetActorGuid());
+    if (!Entry.bLoaded)
+    {
+        Entry.bLoaded = true;
+        ++LoadedCount;
+    }
+    Entry.ActorPackage = Actor.GetPackage()->GetFName();
+    Entry.Uuid = Uuid;
+}
+
+void FAssetTrackerWorldIndex::RemoveActor(const AActor& Actor)
+{
+    FActorEntry Removed;
+    if (Entries.RemoveAndCopyValue(Actor.GetActorGuid(), Removed) && Removed.bLoaded)
+    {
+        --LoadedCount;
+    }
+}
+
+const FGuid* FAssetTrackerWorldIndex::FindUuid(const FGuid& ActorGuid) const
+{
+    const FActorEntry* Entry = Entries.Find(ActorGuid);
+    return Entry ? &Entry->Uuid : nullptr;
+}
+
+void FAssetTrackerWorldIndex::GetUuidCounts(TMap<FGuid, int32>& OutCounts, bool bLoadedOnly) const
+{
+    for (const TPair<FGuid, FActorEntry>& Pair : Entries)
+    {
+        if (bLoadedOnly && !Pair.Value.bLoaded) continue;
+        ++OutCounts.FindOrAdd(Pair.Value.Uuid);
+    }
+}
+
+#endif
@@ -7,21 +7,29 @@
 #include "Http.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Engine/World.h"
+#include "UObject/StrongObjectPtr.h"
+#include "GameDelegates.h"
+#include "AssetTrackerUuidTable.h"
+#include "AssetTrackerWorldIndex.h"
+#include "AssetTrackerHistory.h"
+#include "AssetTrackerEventPipeline.h"
+#include "AssetTrackerTransformStore.h"
+#include "AssetTrackerInstanceTracker.h"
+#include "AssetTrackerClassUuidCache.h"
+#include "AssetTrackerMetaStore.h"
+#include "AssetTrackerMoveCoalescer.h"
 
 
 
 // Forward declarations
 class UFactory;
 class UMaterialInterface;
+class UInstancedStaticMeshComponent;
+class FEditPropertyChain;
 class AActor;
 class UWorld;
-
-struct FMetaEntry
-{
-    FString Uuid;
-    int32   ChatId;
-    int32 UserId;
-};
+class ULevel;
 
 class FAssetTrackerModule : public IModuleInterface
 {
@@ -31,31 +39,119 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
+    static FAssetTrackerModule& Get();
+
+    // 로컬 이력 기반 타임라인 조회 (네트워크 왕복 없음)
+    TArray<FAssetTrackerHistoryRecord> GetUuidTimeline(const FGuid& UUID, const FDateTime& From, const FDateTime& To) const;
+    TArray<FAssetTrackerHistoryRecord> GetActorTimeline(const AActor* Actor, const FDateTime& From, const FDateTime& To) const;
+
+#if WITH_EDITOR
+    // 현재 에디터 맵의 UUID 사용 인덱스 (World Partition 맵에서만 구성됨)
+    const FAssetTrackerWorldIndex& GetWorldIndex() const;
+#endif
+
+    // 패키지 빌드 플레이 중 UUID별 스폰 횟수
+    TMap<FGuid, int32> GetRuntimeUsageCounts() const;
+
 private:
     void LoadMetaJson();
+
+#if WITH_EDITOR
     void TagExistingAssets();
     void OnAssetImported(UFactory* Factory, UObject* CreatedObject);
     void OnObjectPropertyChanged(UObject* ObjectBeingModified, FPropertyChangedEvent& PropertyChangedEvent);
-    FString GetUUIDFromActorMaterials(AActor* Actor);
+    FGuid GetUUIDFromActorMaterials(AActor* Actor);
+    // 스냅샷 슬롯에 기록된 UUID 재사용, 없으면 한 번 해석해서 슬롯에 기록
+    FGuid GetCachedActorUuid(AActor* Actor);
     void OnLevelActorModified(AActor* Actor);
     void OnActorMoved(AActor* Actor);
     void OnActorAdded(AActor* Actor);
+    void OnActorAttached(AActor* Actor, const AActor* Parent);
+
+    // 추적 액터 스냅샷 + 부착 조상 기준 스냅샷 (계층 이동 병합용)
+    void RegisterTrackedActor(AActor* Actor, const FGuid& UUID);
+    void AnchorLoadedHierarchies(UWorld* World);
+
+    FAssetTrackerTransformStore PreviousActorTransforms;
+
+    void ReportTransformChanges(AActor* Actor, const FGuid& UUID, uint8 ChangeMask, const FTransform& CurrentTransform);
+    // 시간 분할 재조정 스윕 (AssetTracker.Reconcile.*)
+    bool TickReconciliation(float DeltaTime);
 
-    TMap<AActor*, FTransform> PreviousActorTransforms;
+    FTSTicker::FDelegateHandle ReconcileTickerHandle;
+    double NextReconcileSweepTime = 0.0;
 
-    FString GetUUIDFromMaterial(UMaterialInterface* Material);
+    // 인스턴스 단위 추적 (ISM/HISM/폴리지)
+    void OnObjectModified(UObject* Object);
+    void OnPreObjectPropertyChanged(UObject* Object, const FEditPropertyChain& PropertyChain);
+    FGuid ResolveInstanceComponentUuid(UInstancedStaticMeshComponent* Component);
+    bool TickInstanceTracking(float DeltaTime);
+
+    FAssetTrackerInstanceTracker InstanceTracker;
+    FTSTicker::FDelegateHandle InstanceTickerHandle;
+
+    // 부착 계층 단위 이동 병합 (부모 이동 한 번 = 이벤트 한 번)
+    bool TickMoveCoalescing(float DeltaTime);
+    void FlushPendingMoves();
+    void FlushMoveGroup(AActor* Root, TArrayView<AActor* const> DirtyDescendants);
+    void CheckActorTransform(AActor* Actor);
+    void ReportHierarchyMove(AActor* Root, const FGuid& UUID, uint8 ChangeMask, const FTransform& CurrentTransform, const FTransform& LastTransform, TArray<FAssetTrackerDescendant>&& Descendants);
+
+    FAssetTrackerMoveCoalescer MoveCoalescer;
+    FTSTicker::FDelegateHandle MoveTickerHandle;
+
+    // 클래스 단위 UUID 사전 계산 (블루프린트/머티리얼 변경 시 무효화)
+    void OnBlueprintCompiled();
+    // 클래스 캐시, ISM 컴포넌트별 UUID, 스냅샷 슬롯 UUID를 함께 무효화
+    void InvalidateUuidCaches();
+
+    FAssetTrackerClassUuidCache ClassUuidCache;
+
+    FGuid GetUUIDFromMaterial(UMaterialInterface* Material);
     void OnActorDeleted(AActor* Actor);
     bool IsActorUsingMaterial(AActor* Actor, UMaterialInterface* Material);
     void CheckMaterialUsageInLevel(UMaterialInterface* Material);
     void OnMaterialUsageChanged();
 
-    void SendActorTrackLog(AActor* Actor, const FString& UUID, int32 ChatId, int32 UserId, const FString& Property);
-    void OnHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
-
-    // Utility functions
-    UWorld* GetWorld() const;
+    // 쿠킹 시 텍스처/머티리얼 → UUID 테이블을 구워서 쿠킹 목록에 추가
+    void BakeUuidTable(TArray<FString>& ExtraPackagesToCook);
+    FCookModificationDelegate PreviousCookModificationDelegate;
 
+    // World Partition 인덱스 유지
+    void OnMapOpened(const FString& Filename, bool bAsTemplate);
+    void OnEditorWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+    void RebuildWorldIndex(UWorld* World);
+    void OnWorldActorLoaded(AActor& Actor);
+    void OnWorldActorUnloaded(AActor& Actor);
 
+    FAssetTrackerWorldIndex WorldIndex;
+    TWeakObjectPtr<ULevel> IndexedLevel;
 
-    TMap<FString, FMetaEntry> MetaMap;
+    // Utility functions
+    UWorld* GetWorld() const;
+#endif
+
+    // 런타임(패키지 빌드) 경로 - 에디터 의존성 없음
+    void LoadBakedUuidTable();
+    void OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues IVS);
+    void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+    void OnRuntimeActorSpawned(AActor* Actor);
+    // 베이크 테이블 엔트리 인덱스 (없으면 INDEX_NONE)
+    int32 FindBakedEntryForActor(AActor* Actor) const;
+
+    void SendActorTrackLog(AActor* Actor, const FGuid& UUID, int32 ChatId, int32 UserId, EAssetTrackerChange Change);
+    void RecordHistory(AActor* Actor, const FGuid& UUID, int32 ChatId, int32 UserId, EAssetTrackerChange Change);
+    void CaptureEvent(AActor* Actor, const FGuid& UUID, int32 ChatId, int32 UserId, EAssetTrackerChange Change, bool bUpload);
+
+    // segments.json (UUID는 로드 시 한 번만 파싱)
+    FAssetTrackerMetaStore MetaStore;
+
+    FAssetTrackerHistory History;
+    FAssetTrackerEventPipeline EventPipeline;
+
+    TStrongObjectPtr<UAssetTrackerUuidTable> BakedUuidTable;
+    TMap<TWeakObjectPtr<UWorld>, FDelegateHandle> ActorSpawnedHandles;
+    // 베이크 엔트리 인덱스별 스폰 횟수 / 세션 내 업로드 여부
+    TArray<int32> RuntimeUsageCounts;
+    TBitArray<> RuntimeUploadedEntries;
 };
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UClass;
+class UMaterialInterface;
+class UMeshComponent;
+
+/**
+ * 액터 클래스 단위 UUID 사전 계산.
+ * CDO 기본 서브오브젝트와 블루프린트 SCS 컴포넌트 템플릿의 머티리얼을 한 번만 해석하고,
+ * 인스턴스는 템플릿과 머티리얼이 다른 컴포넌트(인스턴스별 오버라이드)만 직접 해석한다.
+ */
+class ASSETTRACKER_API FAssetTrackerClassUuidCache
+{
+public:
+    using FResolveMaterial = TFunctionRef<FGuid(UMaterialInterface* Material)>;
+
+    FGuid Resolve(AActor* Actor, FResolveMaterial Resolver);
+
+    // 머티리얼별 결과 메모
+    FGuid ResolveMaterial(UMaterialInterface* Material, FResolveMaterial Resolver);
+
+    // 머티리얼/텍스처 태그/블루프린트가 바뀌면 전체 무효화
+    void Invalidate();
+
+private:
+    struct FTemplateInfo
+    {
+        TArray<TWeakObjectPtr<UMaterialInterface>> Materials;
+        FGuid Uuid;
+    };
+
+    void PrecomputeClass(UClass* Class, FResolveMaterial Resolver);
+    const FTemplateInfo& GetTemplateInfo(const UMeshComponent* Template, FResolveMaterial Resolver);
+    FGuid ResolveComponent(const UMeshComponent* Component, FResolveMaterial Resolver);
+
+    TSet<TWeakObjectPtr<UClass>> PrecomputedClasses;
+    TMap<TWeakObjectPtr<const UMeshComponent>, FTemplateInfo> Templates;
+    TMap<TWeakObjectPtr<UMaterialInterface>, FGuid> MaterialUuids;
+};
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "AssetTrackerEventSink.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+/**
+ * 이벤트 배치 워커.
+ * 게임 스레드는 POD 이벤트를 큐에 넣기만 하고, 워커가 모아서 등록된 싱크
+ * (로컬 이력, HTTP, 공유 메모리 링 등)에 배치 단위로 전달한다.
+ */
+class ASSETTRACKER_API FAssetTrackerEventPipeline : public FRunnable
+{
+public:
+    virtual ~FAssetTrackerEventPipeline();
+
+    // Start 전에 등록. Shutdown 시 모두 해제
+    void AddSink(TUniquePtr<IAssetTrackerEventSink> Sink);
+
+    void Start();
+    void Shutdown();
+
+    void Enqueue(FAssetTrackerEvent&& Event);
+
+    //~ FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    // bLocalOnly: 종료 시 게임 스레드에서 비울 때 로컬 싱크에만 전달
+    void ProcessPending(bool bLocalOnly);
+
+    TArray<TUniquePtr<IAssetTrackerEventSink>> Sinks;
+
+    TQueue<FAssetTrackerEvent, EQueueMode::Mpsc> PendingEvents;
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    std::atomic<bool> bStopping { false };
+
+    // 워커 전용 재사용 버퍼
+    TArray<FAssetTrackerEvent> Batch;
+};
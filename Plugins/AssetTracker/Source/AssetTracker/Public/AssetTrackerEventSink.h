@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetTrackerHistory.h"
+#include "AssetTrackerInstanceTracker.h"
+
+// 계층 이동 이벤트에 포함되는 추적 하위 액터
+struct FAssetTrackerDescendant
+{
+    FName ActorName;
+    FGuid Uuid;
+    int32 ChatId = 0;
+    int32 UserId = 0;
+};
+
+// 게임 스레드에서 캡처하는 이벤트 (문자열 할당 없음, 인스턴스/계층 이벤트만 배열 사용)
+struct FAssetTrackerEvent
+{
+    int64 TimestampTicks = 0;
+    FName ActorName;
+    FName WorldPackage;
+    int32 ChatId = 0;
+    int32 UserId = 0;
+    EAssetTrackerChange Change = EAssetTrackerChange::Other;
+    bool bUpload = true;
+    FGuid Uuid;
+
+    // EAssetTrackerChange::Instances 전용
+    FName ComponentName;
+    TArray<FAssetTrackerInstanceDelta> Instances;
+
+    // EAssetTrackerChange::Hierarchy 전용. Uuid는 루트가 추적 대상이 아니면 무효
+    uint8 TransformMask = 0;
+    FVector3f LocationDelta = FVector3f::ZeroVector;
+    TArray<FAssetTrackerDescendant> Descendants;
+};
+
+// 이벤트를 고정 크기 레코드로 펼침 (계층 이벤트는 하위 액터마다 한 개, 추적되지 않는 루트는 제외)
+ASSETTRACKER_API void AssetTrackerEventToRecords(const FAssetTrackerEvent& Event, FString& NameScratch, TArray<FAssetTrackerHistoryRecord>& OutRecords);
+
+/**
+ * 이벤트 출력 대상.
+ * 파이프라인 워커 스레드에서 배치 단위로 호출되므로 구현은 워커 전용 상태만 사용한다.
+ */
+class IAssetTrackerEventSink
+{
+public:
+    virtual ~IAssetTrackerEventSink() = default;
+
+    virtual const TCHAR* GetName() const = 0;
+
+    // 배치마다 확인 (CVar로 켜고 끄기)
+    virtual bool IsEnabled() const { return true; }
+
+    // 모듈 종료 시 남은 이벤트를 받을지 여부 (네트워크 싱크는 false)
+    virtual bool IsLocal() const { return false; }
+
+    virtual void Consume(TArrayView<const FAssetTrackerEvent> Events) = 0;
+};
+
+// 로컬 이력 싱크 (항상 켜짐)
+class ASSETTRACKER_API FAssetTrackerHistorySink : public IAssetTrackerEventSink
+{
+public:
+    explicit FAssetTrackerHistorySink(FAssetTrackerHistory& InHistory) : History(InHistory) {}
+
+    virtual const TCHAR* GetName() const override { return TEXT("History"); }
+    virtual bool IsLocal() const override { return true; }
+    virtual void Consume(TArrayView<const FAssetTrackerEvent> Events) override;
+
+private:
+    FAssetTrackerHistory& History;
+
+    TArray<FAssetTrackerHistoryRecord> RecordScratch;
+    FString NameScratch;
+};
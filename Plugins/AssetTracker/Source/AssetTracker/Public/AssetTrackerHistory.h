@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class IFileHandle;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+enum class EAssetTrackerChange : uint8
+{
+    Location,
+    Rotation,
+    Scale,
+    Added,
+    Deleted,
+    Spawned,
+    Other,
+    Instances,  // ISM/HISM/폴리지 인스턴스 일괄 변경
+    Hierarchy,  // 부착 계층 루트 이동 (하위 액터 포함)
+};
+
+ASSETTRACKER_API const TCHAR* LexToString(EAssetTrackerChange Change);
+
+// 세그먼트 파일에 그대로 기록되는 고정 크기 레코드
+struct FAssetTrackerHistoryRecord
+{
+    int64 TimestampTicks = 0;   // UTC FDateTime ticks
+    uint64 ActorKey = 0;        // 액터 경로 해시
+    int32 ChatId = 0;
+    int32 UserId = 0;
+    EAssetTrackerChange Change = EAssetTrackerChange::Other;
+    uint8 Pad[7] = {};
+    FGuid Uuid;
+    ANSICHAR ActorName[64] = {};
+
+    FDateTime GetTimestamp() const { return FDateTime(TimestampTicks); }
+    FString GetActorName() const { return FString(UTF8_TO_TCHAR(ActorName)); }
+
+    void SetActorName(const FString& InName);
+
+    // 실행 간에 유지되는 키 (월드 패키지 + 액터 이름)
+    static uint64 MakeActorKey(FName WorldPackage, FName ActorName);
+};
+static_assert(sizeof(FAssetTrackerHistoryRecord) == 112, "History record layout is part of the on-disk format");
+
+/**
+ * 로컬 append-only 이벤트 이력.
+ * 가득 찬 세그먼트는 읽기 전용으로 메모리 매핑하고, UUID/액터별 오프셋 인덱스로
+ * 원격 서버 없이 즉시 타임라인을 조회한다. 오래된 세그먼트는 백그라운드에서 정리.
+ */
+class ASSETTRACKER_API FAssetTrackerHistory
+{
+public:
+    ~FAssetTrackerHistory();
+
+    bool Open(const FString& InDirectory);
+    void Close();
+    bool IsOpen() const { return !Directory.IsEmpty(); }
+
+    // 스레드 안전. 호출당 한 번 잠그고 한 번 플러시하므로 배치 단위로 호출
+    void Append(TArrayView<const FAssetTrackerHistoryRecord> Records);
+
+    // [From, To] 구간의 기록을 시간 순으로 반환
+    void QueryUuid(const FGuid& Uuid, const FDateTime& From, const FDateTime& To, TArray<FAssetTrackerHistoryRecord>& OutRecords) const;
+    void QueryActor(uint64 ActorKey, const FDateTime& From, const FDateTime& To, TArray<FAssetTrackerHistoryRecord>& OutRecords) const;
+
+    // 보존 기간/전체 크기 초과분 삭제. 워커 스레드에서 호출됨
+    void Compact();
+
+private:
+    struct FRecordRef
+    {
+        int32 SegmentId;
+        int32 Index;
+    };
+
+    struct FSealedSegment
+    {
+        int32 Id = 0;
+        FString Filename;
+        TUniquePtr<IMappedFileHandle> MappedFile;
+        TUniquePtr<IMappedFileRegion> Region;
+        const FAssetTrackerHistoryRecord* Records = nullptr;
+        int32 NumRecords = 0;
+    };
+
+    enum class ESealResult : uint8
+    {
+        Sealed,
+        Incompatible,   // 매직/버전 불일치 - 삭제 대상
+        Failed,         // 열기/매핑 실패 - 일시적일 수 있으므로 파일 유지
+    };
+
+    FString MakeSegmentFilename(int32 SegmentId) const;
+    ESealResult SealSegment(int32 SegmentId, const FString& Filename, FSealedSegment& OutSegment) const;
+    bool BeginActiveSegment(int32 SegmentId);
+    void RollActiveSegment();
+    void IndexRecord(const FAssetTrackerHistoryRecord& Record, FRecordRef Ref);
+
+    const FAssetTrackerHistoryRecord* ResolveRef(FRecordRef Ref) const;
+    void QueryRefs(const TArray<FRecordRef>* Refs, const FDateTime& From, const FDateTime& To, TArray<FAssetTrackerHistoryRecord>& OutRecords) const;
+
+    bool TickCompaction(float DeltaTime);
+
+    mutable FCriticalSection Lock;
+
+    FString Directory;
+
+    // Id 오름차순 (빈 Id 허용)
+    TArray<TUniquePtr<FSealedSegment>> SealedSegments;
+    // 매핑하지 못해 인덱스에 없지만 디스크에 남아 있는 세그먼트. Compact()가 정리
+    TArray<FString> UnindexedSegmentFiles;
+
+    int32 ActiveSegmentId = 0;
+    TUniquePtr<IFileHandle> ActiveWriter;
+    TArray<FAssetTrackerHistoryRecord> ActiveRecords;
+
+    TMap<FGuid, TArray<FRecordRef>> UuidIndex;
+    TMap<uint64, TArray<FRecordRef>> ActorIndex;
+
+    FTSTicker::FDelegateHandle CompactionTickerHandle;
+    std::atomic<bool> bCompacting { false };
+};
@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "AssetTrackerEventSink.h"
+
+class FHttpModule;
+
+/**
+ * 원격 이력 서버 업로드 싱크 (AssetTracker.Sink.Http).
+ * chatId/userId 단위로 묶어서 DOM 없는 UTF-8 JSON으로 직렬화한 뒤 POST 한 번으로 보낸다.
+ * 서버 주소는 게임 설정 [AssetTracker] HttpEndpoint (기본값은 현재 개발 서버).
+ */
+class ASSETTRACKER_API FAssetTrackerHttpSink : public IAssetTrackerEventSink
+{
+public:
+    FAssetTrackerHttpSink();
+    virtual ~FAssetTrackerHttpSink();
+
+    virtual const TCHAR* GetName() const override { return TEXT("Http"); }
+    virtual bool IsEnabled() const override;
+    virtual void Consume(TArrayView<const FAssetTrackerEvent> Events) override;
+
+private:
+    void Upload(TArrayView<const FAssetTrackerEvent* const> Events);
+
+    // 요청 완료 콜백 대상. 싱크가 해제되면 약한 바인딩이라 늦게 도착한 응답은 무시됨
+    struct FResponseHandler;
+    TSharedPtr<FResponseHandler, ESPMode::ThreadSafe> ResponseHandler;
+
+    // 업로드 기본 주소 (설정 파일 [AssetTracker] HttpEndpoint)
+    FString Endpoint;
+
+    // 생성 시(게임 스레드) 로드. 워커에서 처음 로드하지 않도록
+    FHttpModule* HttpModule = nullptr;
+
+    // 워커 전용 재사용 버퍼. 직렬화는 여기서 하고 요청에는 완성된 크기만큼 한 번 복사
+    TArray<const FAssetTrackerEvent*> UploadScratch;
+    TArray<uint8> PayloadBuffer;
+    FString NameScratch;
+};
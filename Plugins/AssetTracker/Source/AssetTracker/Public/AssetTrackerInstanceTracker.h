@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InstancedStaticMeshDelegates.h"
+
+class UInstancedStaticMeshComponent;
+
+enum class EAssetTrackerInstanceChange : uint8
+{
+    Moved,
+    Added,
+    Removed,
+};
+
+ASSETTRACKER_API const ANSICHAR* LexToAnsiString(EAssetTrackerInstanceChange Change);
+
+struct FAssetTrackerInstanceDelta
+{
+    int32 Index = INDEX_NONE;
+    EAssetTrackerInstanceChange Change = EAssetTrackerInstanceChange::Moved;
+    // Moved 전용 (추가/삭제는 0)
+    FVector3f LocationDelta = FVector3f::ZeroVector;
+    // 현재 위치 (Removed는 삭제 직전 위치)
+    FVector3f Location = FVector3f::ZeroVector;
+};
+
+/**
+ * ISM/HISM/폴리지 인스턴스 단위 추적.
+ * UUID는 컴포넌트당 한 번만 해석하고, 인스턴스 트랜스폼은 12 float 스냅샷 배열로 보관해
+ * 편집 후 다음 틱에 벡터 비교로 달라진 인스턴스만 모아 한 번에 보고한다.
+ * 첫 기준 스냅샷은 편집 직전(BeginEdit)에 찍어서 컴포넌트의 첫 편집도 보고되게 한다.
+ */
+class ASSETTRACKER_API FAssetTrackerInstanceTracker
+{
+public:
+    using FResolveUuid = TFunctionRef<FGuid(UInstancedStaticMeshComponent* Component)>;
+    using FOnInstancesChanged = TFunctionRef<void(UInstancedStaticMeshComponent* Component, const FGuid& Uuid, TArrayView<const FAssetTrackerInstanceDelta> Deltas)>;
+
+    void Start();
+    void Stop();
+
+    // 편집 직전(Modify/PreEditChange) 호출. UUID 해석 + 아직 없으면 편집 전 상태로 기준 스냅샷
+    void BeginEdit(UInstancedStaticMeshComponent* Component, FResolveUuid ResolveUuid);
+
+    // 인스턴스 편집 가능성이 있는 컴포넌트를 표시 (다음 Flush에서 비교)
+    void MarkDirty(UInstancedStaticMeshComponent* Component);
+    void Forget(const UInstancedStaticMeshComponent* Component);
+
+    // 머티리얼 변경/UUID 캐시 무효화 시 다음 Flush에서 UUID를 다시 해석
+    void InvalidateUuid(const UInstancedStaticMeshComponent* Component);
+    void InvalidateUuids();
+    void Empty();
+
+    void Flush(FResolveUuid ResolveUuid, FOnInstancesChanged OnChanged);
+
+private:
+    // 행렬 0~3행의 xyz (축*스케일 3행 + 이동 1행)
+    struct FInstanceSnapshot
+    {
+        float V[12];
+    };
+
+    struct FComponentState
+    {
+        bool bResolved = false;
+        bool bHasBaseline = false;
+        FGuid Uuid;
+        TArray<FInstanceSnapshot> Snapshots;
+        // 마지막 Flush 이후 추가/삭제된 인스턴스
+        TArray<int32> AddedIndices;
+        TArray<FAssetTrackerInstanceDelta> Removed;
+    };
+
+    void OnInstanceIndexUpdated(UInstancedStaticMeshComponent* Component, TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> IndexUpdates);
+    void ResolveComponent(UInstancedStaticMeshComponent* Component, FComponentState& State, FResolveUuid ResolveUuid);
+    void CaptureBaseline(UInstancedStaticMeshComponent* Component, FComponentState& State);
+    void DiffComponent(UInstancedStaticMeshComponent* Component, FComponentState& State);
+
+    TMap<TWeakObjectPtr<UInstancedStaticMeshComponent>, FComponentState> States;
+    TSet<TWeakObjectPtr<UInstancedStaticMeshComponent>> DirtyComponents;
+
+    TArray<FAssetTrackerInstanceDelta> DeltaScratch;
+    FDelegateHandle IndexUpdatedHandle;
+};
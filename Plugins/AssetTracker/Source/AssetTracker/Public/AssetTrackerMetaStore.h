@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// UUID 문자열 파싱 (하이픈 포함/미포함 모두 허용). 실패 시 무효 GUID
+ASSETTRACKER_API FGuid AssetTrackerParseUuid(const FString& Text);
+// 직렬화/로그 경계에서만 사용 (소문자 하이픈 형식)
+ASSETTRACKER_API FString AssetTrackerUuidToString(const FGuid& Uuid);
+// 할당 없는 UTF-8 형식화. 널 제외 36자
+ASSETTRACKER_API int32 AssetTrackerFormatUuid(const FGuid& Uuid, ANSICHAR (&Out)[37]);
+
+// segments.json 항목 (문자열 없음)
+struct FAssetTrackerMeta
+{
+    FGuid Uuid;
+    int32 ChatId = 0;
+    int32 UserId = 0;
+};
+static_assert(sizeof(FAssetTrackerMeta) == 24, "Meta entries are packed into a flat array");
+
+/**
+ * UUID → chatId/userId 메타 저장소.
+ * UUID는 로드 시 한 번만 128비트 키로 파싱하고, UUID 순으로 정렬된 평면 배열에서 이진 탐색한다.
+ */
+class ASSETTRACKER_API FAssetTrackerMetaStore
+{
+public:
+    void Reset(int32 ExpectedNum = 0);
+    void Add(const FGuid& Uuid, int32 ChatId, int32 UserId);
+    // UUID 정렬 + 중복 제거 (나중 값 유지). 조회 전에 반드시 호출
+    void Finalize();
+
+    const FAssetTrackerMeta* Find(const FGuid& Uuid) const;
+    bool Contains(const FGuid& Uuid) const { return Find(Uuid) != nullptr; }
+
+    int32 Num() const { return Entries.Num(); }
+    TConstArrayView<FAssetTrackerMeta> GetEntries() const { return Entries; }
+
+private:
+    TArray<FAssetTrackerMeta> Entries;
+};
@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * 부착 계층 단위 이동 병합.
+ * 이동/프로퍼티 변경 델리게이트에서는 액터를 표시만 하고, 다음 틱에 표시된 액터들을
+ * 최상위 dirty 조상 기준으로 묶어서 부모 이동 한 번이 하위 액터 수만큼 보고되지 않게 한다.
+ */
+class ASSETTRACKER_API FAssetTrackerMoveCoalescer
+{
+public:
+    // Root와 같은 서브트리에 속한 나머지 dirty 액터
+    using FOnGroup = TFunctionRef<void(AActor* Root, TArrayView<AActor* const> DirtyDescendants)>;
+
+    void MarkDirty(AActor* Actor);
+    void Empty();
+
+    void Flush(FOnGroup OnGroup);
+
+    // Actors 안에서의 최상위 조상 기준으로 묶음 (루트가 바뀌지 않았을 때 하위 그룹 재분할에도 사용)
+    static void GroupBySubtree(TArrayView<AActor* const> Actors, FOnGroup OnGroup);
+
+private:
+    TSet<TWeakObjectPtr<AActor>> DirtyActors;
+};
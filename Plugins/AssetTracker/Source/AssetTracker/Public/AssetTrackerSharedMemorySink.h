@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetTrackerEventSink.h"
+#include <atomic>
+
+/**
+ * 공유 메모리 링 선두 헤더. 바로 뒤에 FAssetTrackerHistoryRecord가 Capacity개 이어진다.
+ * 생산자(에디터)는 WriteIndex와 DroppedCount만, 소비자(사이드카)는 ReadIndex만 쓴다.
+ * 인덱스는 단조 증가하며 슬롯은 Index & (Capacity - 1).
+ * Epoch는 생산자가 링을 새로 초기화할 때마다 바뀐다. 소비자는 Epoch가 바뀌면 ReadIndex를 WriteIndex로 맞춘다.
+ */
+struct FAssetTrackerRingHeader
+{
+    static constexpr uint32 MagicValue = 0x42525441; // "ATRB"
+    static constexpr uint32 CurrentVersion = 2;
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    uint32 RecordSize = 0;
+    uint32 Capacity = 0;   // 2의 거듭제곱
+    uint64 Epoch = 0;      // 초기화 시각 (UTC ticks)
+
+    alignas(64) std::atomic<uint64> WriteIndex { 0 };
+    alignas(64) std::atomic<uint64> ReadIndex { 0 };
+    alignas(64) std::atomic<uint64> DroppedCount { 0 };
+};
+static_assert(sizeof(FAssetTrackerRingHeader) == 256, "Ring header layout is shared with the consumer process");
+
+/**
+ * 로컬 사이드카용 무잠금 단일 생산자 공유 메모리 링 싱크 (AssetTracker.Sink.SharedMemory).
+ * 이벤트를 이력과 같은 고정 크기 바이너리 레코드로 펼쳐 복사만 하고 배치당 한 번 게시한다.
+ * 링이 가득 차면 에디터를 막지 않고 새 레코드를 버린 뒤 DroppedCount를 올린다.
+ * CVar를 끄면 링을 해제하고, 다시 켜면 그때의 Name/Capacity로 새로 매핑한다 (매핑 실패도 재시도).
+ */
+class ASSETTRACKER_API FAssetTrackerSharedMemorySink : public IAssetTrackerEventSink
+{
+public:
+    virtual ~FAssetTrackerSharedMemorySink();
+
+    virtual const TCHAR* GetName() const override { return TEXT("SharedMemory"); }
+    virtual bool IsEnabled() const override;
+    virtual bool IsLocal() const override { return true; }
+    virtual void Consume(TArrayView<const FAssetTrackerEvent> Events) override;
+
+private:
+    bool Map();
+    void Unmap();
+
+    FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+    FAssetTrackerRingHeader* Header = nullptr;
+    FAssetTrackerHistoryRecord* Records = nullptr;
+    uint32 CapacityMask = 0;
+    // CVar가 꺼질 때 IsEnabled에서 해제 (워커가 배치마다 호출)
+    mutable bool bMapFailed = false;
+    // 소비자 ReadIndex가 이 링의 범위를 벗어남 (이전 Epoch의 사이드카)
+    bool bConsumerOutOfSync = false;
+
+    // 워커 전용 재사용 버퍼
+    TArray<FAssetTrackerHistoryRecord> RecordScratch;
+    FString NameScratch;
+};
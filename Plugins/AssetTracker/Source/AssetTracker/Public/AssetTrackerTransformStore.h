@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+namespace EAssetTrackerTransformChange
+{
+    enum Type : uint8
+    {
+        None     = 0,
+        Location = 1 << 0,
+        Rotation = 1 << 1,
+        Scale    = 1 << 2,
+    };
+}
+
+/**
+ * 추적 액터의 마지막 트랜스폼 스냅샷.
+ * 4개 액터 단위 SoA 블록으로 저장해서 재조정(reconciliation) 스윕 시
+ * 벡터 레지스터로 한 번에 허용 오차 비교를 한다.
+ */
+class ASSETTRACKER_API FAssetTrackerTransformStore
+{
+public:
+    static constexpr int32 LanesPerBlock = 4;
+
+    bool Get(const AActor* Actor, FTransform& OutTransform) const;
+    void Set(AActor* Actor, const FTransform& Transform, const FGuid& Uuid);
+    void Remove(const AActor* Actor);
+    void Empty();
+
+    // 부모 이동으로 바뀐 하위 액터 스냅샷: 비교 없이 다음 접근(Get/스윕) 때 새로 기록
+    void MarkStale(const AActor* Actor);
+
+    // 슬롯에 기록된 UUID (무효 UUID = 추적 대상 아님). 슬롯이 없거나 UUID가 무효화됐으면 false
+    bool FindUuid(const AActor* Actor, FGuid& OutUuid) const;
+    // 스냅샷은 그대로 두고 UUID만 갱신. 같은 액터의 슬롯이 없으면 false
+    bool SetUuid(const AActor* Actor, const FGuid& Uuid);
+    // 머티리얼/블루프린트 변경 시 다음 FindUuid에서 다시 해석하도록
+    void InvalidateUuid(const AActor* Actor);
+    void InvalidateUuids();
+
+    int32 Num() const { return SlotLookup.Num(); }
+
+    // 단일 액터 비교 (델리게이트 경로). 스윕과 같은 기준
+    static uint8 Compare(const FTransform& Current, const FTransform& Previous, double Tolerance);
+
+    /**
+     * 커서 위치부터 최대 MaxSlots개 슬롯을 현재 트랜스폼과 비교하고 스냅샷을 갱신.
+     * 실제로 달라진 추적 액터만 콜백 (stale 슬롯과 UUID 없는 기준점은 갱신만). 한 바퀴를 다 돌면 true.
+     */
+    bool ReconcileSlice(int32 MaxSlots, double Tolerance,
+        TFunctionRef<void(AActor* Actor, const FGuid& Uuid, uint8 ChangeMask, const FTransform& Current)> OnChanged);
+
+private:
+    struct FBlock
+    {
+        double LocX[LanesPerBlock];
+        double LocY[LanesPerBlock];
+        double LocZ[LanesPerBlock];
+        double RotX[LanesPerBlock];
+        double RotY[LanesPerBlock];
+        double RotZ[LanesPerBlock];
+        double RotW[LanesPerBlock];
+        double ScaleX[LanesPerBlock];
+        double ScaleY[LanesPerBlock];
+        double ScaleZ[LanesPerBlock];
+
+        void Write(int32 Lane, const FTransform& Transform);
+        FTransform Read(int32 Lane) const;
+    };
+
+    // 블록 하나(4 레인)를 비교해서 레인별 변경 마스크를 채움
+    static void CompareBlock(const FBlock& Current, const FBlock& Previous, double Tolerance, uint8 OutMasks[LanesPerBlock]);
+
+    int32 AllocateSlot();
+    void ReleaseStaleSlot(int32 Slot);
+
+    TArray<FBlock> Blocks;
+    TArray<TWeakObjectPtr<AActor>> SlotActors;
+    TArray<FGuid> SlotUuids;
+    // 슬롯별 SlotLookup 키 (stale 슬롯 해제 시 역조회 없이 제거)
+    TArray<const AActor*> SlotKeys;
+    TBitArray<> StaleSlots;
+    TBitArray<> ResolvedUuids;
+    TArray<int32> FreeSlots;
+    TMap<const AActor*, int32> SlotLookup;
+
+    int32 Cursor = 0;
+};
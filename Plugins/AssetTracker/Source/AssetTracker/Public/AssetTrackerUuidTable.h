@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AssetTrackerUuidTable.generated.h"
+
+USTRUCT()
+struct FAssetTrackerBakedEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FGuid Uuid;
+
+    UPROPERTY()
+    int32 ChatId = 0;
+
+    UPROPERTY()
+    int32 UserId = 0;
+};
+
+/**
+ * 쿠킹 시점에 구워지는 머티리얼 경로 → UUID 테이블.
+ * 패키지 빌드에서는 에디터 메타데이터가 없으므로 이 테이블만으로 UUID를 찾는다.
+ */
+UCLASS()
+class ASSETTRACKER_API UAssetTrackerUuidTable : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    static const TCHAR* PackageName;
+    static const TCHAR* ObjectPath;
+
+    // 스폰 경로용. 문자열 변환 없이 정렬된 경로를 이진 탐색
+    int32 FindEntryIndex(const UObject* Asset) const;
+    const FAssetTrackerBakedEntry* Find(const UObject* Asset) const;
+
+    const FAssetTrackerBakedEntry& GetEntry(int32 EntryIndex) const { return Entries[EntryIndex]; }
+    int32 NumEntries() const { return Entries.Num(); }
+    int32 Num() const { return Paths.Num(); }
+
+#if WITH_EDITOR
+    void Reset();
+    void Add(const FSoftObjectPath& Path, const FAssetTrackerBakedEntry& Entry);
+    // 경로 정렬 + 중복 제거. 저장 전에 반드시 호출
+    void Finalize();
+#endif
+
+private:
+    // 에셋 경로 순서 (FName 문자열 비교). 쿠킹 결과가 실행마다 같고 로드 시 재구성이 필요 없음
+    static bool PathLess(const FTopLevelAssetPath& A, const FTopLevelAssetPath& B) { return A.Compare(B) < 0; }
+
+    // 정렬된 에셋 경로. EntryIndices와 같은 순서
+    UPROPERTY()
+    TArray<FTopLevelAssetPath> Paths;
+
+    UPROPERTY()
+    TArray<int32> EntryIndices;
+
+    // UUID별로 한 번만 저장
+    UPROPERTY()
+    TArray<FAssetTrackerBakedEntry> Entries;
+
+#if WITH_EDITOR
+    // 베이크 중 UUID → Entries 인덱스
+    TMap<FGuid, int32> PendingEntryLookup;
+#endif
+};
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+class AActor;
+class UWorld;
+class FAssetTrackerMetaStore;
+
+/**
+ * 맵 단위 UUID 사용 인덱스.
+ * World Partition 액터 디스크립터와 에셋 레지스트리 의존성만으로 UUID를 해석하므로
+ * 셀을 로드하지 않고도 월드 전체 감사/집계가 가능하다. 셀 로드/언로드 시 로드 상태만 갱신.
+ */
+class ASSETTRACKER_API FAssetTrackerWorldIndex
+{
+public:
+    void Build(UWorld* InWorld, const FAssetTrackerMetaStore& MetaStore);
+    void Reset();
+
+    bool IsBuiltFor(const UWorld* InWorld) const { return InWorld && World.Get() == InWorld; }
+
+    // 셀 로드/언로드 및 에디터 추가/삭제 반영
+    void OnActorLoaded(const AActor& Actor);
+    void OnActorUnloaded(const AActor& Actor);
+    void SetActorUuid(const AActor& Actor, const FGuid& Uuid);
+    void RemoveActor(const AActor& Actor);
+
+    const FGuid* FindUuid(const FGuid& ActorGuid) const;
+
+    // UUID별 추적 액터 수. bLoadedOnly=false면 언로드된 셀까지 포함
+    void GetUuidCounts(TMap<FGuid, int32>& OutCounts, bool bLoadedOnly = false) const;
+
+    int32 NumTracked() const { return Entries.Num(); }
+    int32 NumLoaded() const { return LoadedCount; }
+
+private:
+    struct FActorEntry
+    {
+        FName ActorPackage;
+        FGuid Uuid;
+        bool bLoaded = false;
+    };
+
+    // bOutTruncated: 깊이 제한/순환 때문에 탐색이 끊겼으면 true (결과는 메모하지 않음)
+    FGuid ResolvePackageUuid(FName PackageName, int32 Depth, bool& bOutTruncated);
+
+    TWeakObjectPtr<UWorld> World;
+
+    // 추적 대상 액터만 저장 (액터 GUID → 엔트리)
+    TMap<FGuid, FActorEntry> Entries;
+
+    // 태그된 텍스처 패키지 → UUID
+    TMap<FName, FGuid> TexturePackageUuids;
+    // 패키지별 해석 결과 메모 (무효 GUID = UUID 없음)
+    TMap<FName, FGuid> PackageUuidCache;
+    // 현재 탐색 경로 위의 패키지 (순환 차단용)
+    TSet<FName> ResolvingPackages;
+
+    int32 LoadedCount = 0;
+};
+
+#endif